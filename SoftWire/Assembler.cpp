@@ -10,22 +10,31 @@
 #include "Operand.hpp"
 #include "Synthesizer.hpp"
 #include "InstructionSet.hpp"
+#include "CPUID.hpp"
 
 #include <time.h>
 
+#ifdef __unix__
+	#include <unistd.h>
+#else
+	#include <process.h>
+	#define getpid _getpid
+#endif
+
 namespace SoftWire
 {
 	InstructionSet *Assembler::instructionSet = 0;
 	int Assembler::referenceCount = 0;
+	char *Assembler::cacheDirectory = 0;
+	int Assembler::temporaryCount = 0;
+	Mutex Assembler::temporaryMutex;
 
 	Assembler::Assembler(const char *sourceFile)
 	{
+		initialize(0);
+
 		try
 		{
-			errors = new char[1];
-			errors[0] = '\0';
-			echoFile = 0;
-
 			if(sourceFile)
 			{
 				entryLabel = strdup(sourceFile);
@@ -39,34 +48,12 @@ namespace SoftWire
 				{
 					throw Error("Input file must have extension");
 				}
-			}
-			else
-			{
-				entryLabel = 0;
-			}
-
-			if(!instructionSet)
-			{
-				instructionSet = new InstructionSet();
-			}
-			referenceCount++;
 
-			linker = new Linker();
-			loader = new Loader(*linker);
-			synthesizer = new Synthesizer();
-
-			if(sourceFile)
-			{
 				scanner = new Scanner();
 				parser = new Parser(*scanner, *synthesizer, *instructionSet);
 
-				scanner->scanFile(sourceFile);
-				assembleFile();
-			}
-			else
-			{
-				scanner = 0;
-				parser = 0;
+				scanner->scanFile(sourceFile, false);
+				assembleSource();
 			}
 		}
 		catch(const Error &error)
@@ -75,6 +62,70 @@ namespace SoftWire
 		}
 	}
 
+	Assembler::Assembler(const char *source, int length, const char *entryLabel)
+	{
+		initialize(entryLabel);
+
+		try
+		{
+			scanner = new Scanner();
+			parser = new Parser(*scanner, *synthesizer, *instructionSet);
+
+			scanner->scanBuffer(source, length, false);
+			assembleSource();
+		}
+		catch(const Error &error)
+		{
+			handleError(error.getString());
+		}
+	}
+
+	Assembler::Assembler(Reader reader, void *context, const char *entryLabel)
+	{
+		initialize(entryLabel);
+
+		try
+		{
+			scanner = new Scanner();
+			parser = new Parser(*scanner, *synthesizer, *instructionSet);
+
+			scanner->scanStream(reader, context, false);
+			assembleSource();
+		}
+		catch(const Error &error)
+		{
+			handleError(error.getString());
+		}
+	}
+
+	void Assembler::initialize(const char *entryLabel)
+	{
+		errors = new char[1];
+		errors[0] = '\0';
+		echoFile = 0;
+		last = 0;
+
+		this->entryLabel = entryLabel ? strdup(entryLabel) : 0;
+
+		if(!instructionSet)
+		{
+			instructionSet = new InstructionSet();
+		}
+		referenceCount++;
+
+		linker = new Linker();
+		loader = new Loader(*linker, *instructionSet);
+		synthesizer = new Synthesizer();
+
+		scanner = 0;
+		parser = 0;
+
+		cacheName = 0;
+		cacheSource = 0;
+		cacheSourceSize = 0;
+		precompiled = false;
+	}
+
 	Assembler::~Assembler()
 	{
 		delete entryLabel;
@@ -86,8 +137,12 @@ namespace SoftWire
 		delete loader;
 		loader = 0;
 
-		delete scanner;
-		scanner = 0;
+		if(scanner)
+		{
+			delete scanner;
+			scanner = 0;
+			Scanner::clearSymbols();
+		}
 
 		delete synthesizer;
 		synthesizer = 0;
@@ -107,6 +162,53 @@ namespace SoftWire
 
 		delete[] echoFile;
 		echoFile = 0;
+
+		releaseCache();
+	}
+
+	void Assembler::assembleSource()
+	{
+		if(!scanner)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		if(!cacheDirectory)
+		{
+			scanner->preprocess();
+			assembleFile();
+
+			return;
+		}
+
+		cacheKey[0] = 2166136261u;
+		cacheKey[1] = 5381;
+		cacheKey[2] = CPUID::getTarget();
+		cacheKey[3] = InstructionSet::isTargetEnforced();
+		cacheSource = scanner->fingerprint(cacheKey, cacheSourceSize);
+
+		cacheName = new char[strlen(cacheDirectory) + 32];
+		sprintf(cacheName, "%s/%.8X%.8X%.8X%.1X", cacheDirectory, cacheKey[0], cacheKey[1], cacheKey[2], cacheKey[3]);
+
+		if(loadPrecompiled(true))
+		{
+			precompiled = true;
+			releaseScanner();
+
+			return;
+		}
+
+		if(loadPrecompiled(false))
+		{
+			releaseScanner();
+
+			return;
+		}
+
+		scanner->preprocess();
+		assembleFile();
+
+		savePrecompiled(false);
 	}
 
 	void Assembler::assembleFile()
@@ -128,13 +230,144 @@ namespace SoftWire
 			}
 		}
 
+		releaseScanner();
+	}
+
+	void Assembler::releaseScanner()
+	{
 		delete scanner;
 		scanner = 0;
+		Scanner::clearSymbols();
 
 		delete parser;
 		parser = 0;
 	}
 
+	bool Assembler::loadPrecompiled(bool image)
+	{
+		char fileName[1024];
+		snprintf(fileName, 1024, "%s.%s", cacheName, image ? "swc" : "swo");
+
+		FILE *file = fopen(fileName, "rb");
+
+		if(!file)
+		{
+			return false;
+		}
+
+		char magic[4];
+		unsigned int fileKey[4];
+		int sourceSize = 0;
+
+		bool loaded = fread(magic, 1, 4, file) == 4 && memcmp(magic, image ? "SWC2" : "SWO2", 4) == 0 &&
+		              fread(fileKey, sizeof(unsigned int), 4, file) == 4 && memcmp(fileKey, cacheKey, sizeof(fileKey)) == 0 &&
+		              fread(&sourceSize, sizeof(int), 1, file) == 1 && sourceSize == cacheSourceSize;
+
+		// The key only selects the file, the source it was assembled from has to match exactly
+		if(loaded && sourceSize)
+		{
+			char *source = new char[sourceSize];
+			loaded = fread(source, 1, sourceSize, file) == (size_t)sourceSize && memcmp(source, cacheSource, sourceSize) == 0;
+			delete[] source;
+		}
+
+		loaded = loaded && (image ? loader->readImage(file) : loader->readEncodings(file));
+
+		fclose(file);
+
+		return loaded;
+	}
+
+	void Assembler::savePrecompiled(bool image) const
+	{
+		char fileName[1024];
+		snprintf(fileName, 1024, "%s.%s", cacheName, image ? "swc" : "swo");
+
+		// Written under a temporary name so concurrent assemblers never read a partial file
+		int count;
+
+		{
+			Lock lock(temporaryMutex);
+			count = temporaryCount++;
+		}
+
+		char temporary[1060];
+		snprintf(temporary, 1060, "%s.%d.%d", fileName, (int)getpid(), count);
+
+		FILE *file = fopen(temporary, "wb");
+
+		if(!file)
+		{
+			return;
+		}
+
+		bool written = fwrite(image ? "SWC2" : "SWO2", 1, 4, file) == 4 &&
+		               fwrite(cacheKey, sizeof(unsigned int), 4, file) == 4 &&
+		               fwrite(&cacheSourceSize, sizeof(int), 1, file) == 1 &&
+		               (cacheSourceSize == 0 || fwrite(cacheSource, 1, cacheSourceSize, file) == (size_t)cacheSourceSize) &&
+		               (image ? loader->writeImage(file) : loader->writeEncodings(file));
+
+		if(fclose(file) == 0 && written)
+		{
+			remove(fileName);
+
+			if(rename(temporary, fileName) == 0)
+			{
+				return;
+			}
+		}
+
+		remove(temporary);
+	}
+
+	void Assembler::cacheImage()
+	{
+		if(!cacheName)
+		{
+			return;
+		}
+
+		if(!precompiled)
+		{
+			savePrecompiled(true);
+		}
+
+		releaseCache();
+	}
+
+	void Assembler::releaseCache()
+	{
+		delete[] cacheName;
+		cacheName = 0;
+
+		delete[] cacheSource;
+		cacheSource = 0;
+		cacheSourceSize = 0;
+	}
+
+	void Assembler::appendEncoding(const Encoding &encoding)
+	{
+		if(cacheName)   // Code with run-time intrinsics is not cached
+		{
+			if(precompiled)
+			{
+				delete loader;
+				loader = new Loader(*linker, *instructionSet);
+
+				if(!loadPrecompiled(false))
+				{
+					throw Error("Precompiled encodings '%s.swo' not found", cacheName);
+				}
+
+				precompiled = false;
+			}
+
+			releaseCache();
+		}
+
+		last = loader->appendEncoding(encoding);
+	}
+
 	void Assembler::defineExternal(void *pointer, const char *name)
 	{
 		Linker::defineExternal(pointer, name);
@@ -145,21 +378,73 @@ namespace SoftWire
 		Scanner::defineSymbol(value, name);
 	}
 
-	void (*Assembler::callable(const char *entryLabel))()
+	void Assembler::setIncludeResolver(IncludeResolver resolver, void *context)
 	{
-		if(!loader || errors[0] != '\0')
+		Scanner::setIncludeResolver(resolver, context);
+	}
+
+	void Assembler::clearIncludeCache()
+	{
+		Scanner::clearIncludeCache();
+	}
+
+	void Assembler::setCacheDirectory(const char *directory)
+	{
+		delete[] cacheDirectory;
+		cacheDirectory = directory ? strdup(directory) : 0;
+	}
+
+	void Assembler::setTarget(int features)
+	{
+		CPUID::setTarget(features);
+	}
+
+	void Assembler::enforceTarget(bool enforce)
+	{
+		InstructionSet::enforceTarget(enforce);
+	}
+
+	void Assembler::defineVersion(const char *routine, const char *entryLabel, int features)
+	{
+		if(!loader)
 		{
-			return 0;
+			return;
 		}
 
-		if(entryLabel)
+		loader->defineVersion(routine, entryLabel, features);
+	}
+
+	void Assembler::dispatch(const char *routine)
+	{
+		try
 		{
-			return loader->callable(entryLabel);
+			if(!loader)
+			{
+				return;
+			}
+
+			const char *entryLabel = loader->selectVersion(routine);
+
+			label(routine);
+			jmp(entryLabel);
 		}
-		else
+		catch(Error &error)
 		{
-			return loader->callable(this->entryLabel);
+			handleError(error.getString());
+		}
+	}
+
+	void (*Assembler::callable(const char *entryLabel))()
+	{
+		if(!loader || errors[0] != '\0')
+		{
+			return 0;
 		}
+
+		void (*code)() = loader->callable(entryLabel ? entryLabel : this->entryLabel);
+		cacheImage();
+
+		return code;
 	}
 
 	void (*Assembler::finalize(const char *entryLabel))()
@@ -194,6 +479,8 @@ namespace SoftWire
 		delete[] echoFile;
 		echoFile = 0;
 
+		releaseCache();   // Externals have been cleared
+
 		if(entryLabel)
 		{
 			delete[] this->entryLabel;
@@ -235,7 +522,7 @@ namespace SoftWire
 
 	void Assembler::handleError(const char *error)
 	{
-		const char *sourceLine = parser->skipLine();
+		const char *sourceLine = parser ? parser->skipLine() : "";
 
 		int previousLength = 0;
 
@@ -317,6 +604,11 @@ namespace SoftWire
 
 			const Instruction *instruction = instructionSet->instruction(instructionID);
 
+			if(!InstructionSet::supported(instruction))
+			{
+				throw Error("Instruction '%s' not supported by target processor", instruction->getMnemonic());
+			}
+
 			if(echoFile)
 			{
 				FILE *file = fopen(echoFile, "at");
@@ -346,7 +638,7 @@ namespace SoftWire
 			synthesizer->encodeThirdOperand(thirdOperand);
 			const Encoding &encoding = synthesizer->encodeInstruction(instruction);
 
-			loader->appendEncoding(encoding);
+			appendEncoding(encoding);
 		}
 		catch(Error &error)
 		{
@@ -356,6 +648,41 @@ namespace SoftWire
 		return instructionID;
 	}
 
+	const Instruction *Assembler::instruction(int instructionID)
+	{
+		if(!instructionSet)
+		{
+			return 0;
+		}
+
+		return instructionSet->instruction(instructionID);
+	}
+
+	int Assembler::semantics(int instructionID)
+	{
+		if(!instructionSet || instructionID < 0)
+		{
+			return 0;
+		}
+
+		return instructionSet->semantics(instructionID);
+	}
+
+	unsigned int Assembler::implicitRegisters(int instructionID)
+	{
+		if(!instructionSet || instructionID < 0)
+		{
+			return 0;
+		}
+
+		return instructionSet->implicitRegisters(instructionID);
+	}
+
+	Encoding *Assembler::lastEncoding() const
+	{
+		return last;
+	}
+
 	void Assembler::label(const char *label)
 	{
 		try
@@ -379,7 +706,7 @@ namespace SoftWire
 			synthesizer->defineLabel(label);
 			const Encoding &encoding = synthesizer->encodeInstruction(0);
 
-			loader->appendEncoding(encoding);
+			appendEncoding(encoding);
 		}
 		catch(Error &error)
 		{
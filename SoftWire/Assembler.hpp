@@ -2,6 +2,7 @@
 #define SoftWire_Assembler_hpp
 
 #include "Operand.hpp"
+#include "Mutex.hpp"
 
 namespace SoftWire
 {
@@ -13,21 +14,38 @@ namespace SoftWire
 	class Loader;
 	class Error;
 	class InstructionSet;
+	class Encoding;
 
 	class Assembler
 	{
 	public:
+		typedef int (*Reader)(void *context, char *buffer, int size);
+		typedef const char *(*IncludeResolver)(void *context, const char *fileName, int &length);
+
 		Assembler(const char *fileName = 0);
+		Assembler(const char *source, int length, const char *entryLabel = 0);
+		Assembler(Reader reader, void *context, const char *entryLabel = 0);
 
-		~Assembler();
+		virtual ~Assembler();
 
 		// Run-time intrinsics
-		void label(const char *label);
+		virtual void label(const char *label);
 		#include "Intrinsics.hpp"
 
 		// Methods for passing data references
 		static void defineExternal(void *pointer, const char *name);
 		static void defineSymbol(int value, const char *name);
+		static void setIncludeResolver(IncludeResolver resolver, void *context = 0);
+		static void clearIncludeCache();
+		static void setCacheDirectory(const char *directory);   // Precompiled .swo and .swc files, 0 disables
+
+		// Processor target, defaults to the processor we're running on
+		static void setTarget(int features);
+		static void enforceTarget(bool enforce = true);
+
+		// Multi-versioned routines, callable() picks the best version for the target
+		void defineVersion(const char *routine, const char *entryLabel, int features);
+		void dispatch(const char *routine);   // Stub with a stable address
 
 		// Retrieve assembly code
 		void (*callable(const char *entryLabel = 0))();
@@ -41,11 +59,26 @@ namespace SoftWire
 		void setEchoFile(const char *echoFile, const char *mode = "wt");
 		void annotate(const char *format, ...);
 
+	protected:
+		virtual int x86(int instructionID,
+		                const Operand &firstOperand = VOID,
+		                const Operand &secondOperand = VOID,
+		                const Operand &thirdOperand = VOID);   // Assemble run-time intrinsic
+
+		static const Instruction *instruction(int instructionID);
+		static int semantics(int instructionID);   // InstructionSet::Semantics flags
+		static unsigned int implicitRegisters(int instructionID);
+
+		Encoding *lastEncoding() const;   // Can still be changed until the code is loaded
+
 	private:
 		char *entryLabel;
 
 		static InstructionSet *instructionSet;
 		static int referenceCount;
+		static char *cacheDirectory;
+		static int temporaryCount;   // Distinguishes files written by threads of one process
+		static Mutex temporaryMutex;
 
 		Scanner *scanner;
 		Parser *parser;
@@ -55,15 +88,25 @@ namespace SoftWire
 
 		char *errors;
 		char *echoFile;
+		Encoding *last;
 
+		char *cacheName;   // Precompiled files, without extension
+		unsigned int cacheKey[4];
+		char *cacheSource;   // Fingerprinted tokens, confirm that a precompiled file matches
+		int cacheSourceSize;
+		bool precompiled;   // Machine code loaded
+
+		void initialize(const char *entryLabel);
+		void assembleSource();
 		void assembleFile();
+		void releaseScanner();
+		bool loadPrecompiled(bool image);
+		void savePrecompiled(bool image) const;
+		void cacheImage();
+		void releaseCache();
+		void appendEncoding(const Encoding &encoding);
 		void assembleLine();
 
-		int x86(int instructionID,
-		        const Operand &firstOperand = VOID,
-		        const Operand &secondOperand = VOID,
-		        const Operand &thirdOperand = VOID);   // Assemble run-time intrinsic
-
 		void handleError(const char *error);
 	};
 
@@ -0,0 +1,94 @@
+#include "Scanner.hpp"
+#include "Error.hpp"
+
+#include <stdio.h>
+#include <time.h>
+
+using namespace SoftWire;
+
+// Times the tokenizer on a generated listing, without preprocessing
+
+const int LINES = 200000;
+const int RUNS = 30;
+
+bool generateListing(const char *fileName)
+{
+	static const char *reg[] = {"eax", "ecx", "edx", "ebx", "esi", "edi"};
+
+	FILE *file = fopen(fileName, "w");
+
+	if(!file)
+	{
+		return false;
+	}
+
+	unsigned int seed = 1;   // Same listing on every run
+
+	for(int line = 1; line <= LINES; line++)
+	{
+		seed = seed * 1103515245 + 12345;
+		const int r = seed >> 16 & 0x7FFF;
+
+		if(r % 20 == 0)
+		{
+			fprintf(file, "\n");
+		}
+		else if(r % 10 == 1)
+		{
+			fprintf(file, "; generated comment line %d with some text to skip over quickly\n", line);
+		}
+		else
+		{
+			fprintf(file, "\t\tmov\t\t%s, dword ptr [%s+%d]   // load operand %d\n", reg[r / 20 % 6], reg[r / 120 % 6], 4 * line, line);
+		}
+	}
+
+	return fclose(file) == 0;
+}
+
+int main()
+{
+	if(!generateListing("Benchmark.asm"))
+	{
+		printf("Could not create Benchmark.asm\n");
+		return 1;
+	}
+
+	int tokens = 0;
+	double best = 0;
+
+	try
+	{
+		for(int run = 0; run < RUNS; run++)
+		{
+			const clock_t start = clock();
+
+			Scanner scanner;
+			scanner.scanFile("Benchmark.asm", false);
+
+			const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+			if(run == 0 || seconds < best)
+			{
+				best = seconds;
+			}
+
+			if(run == 0)
+			{
+				for(scanner.rewind(); !scanner.isEndOfFile(); scanner.advance())
+				{
+					tokens++;
+				}
+			}
+		}
+	}
+	catch(const Error &error)
+	{
+		printf("%s\n", error.getString());
+		return 1;
+	}
+
+	printf("%d lines, %d tokens, best of %d runs: %.3f s, %.1f Mtokens/s\n", LINES, tokens, RUNS, best, tokens / best / 1e6);
+
+	return 0;
+}
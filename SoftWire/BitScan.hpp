@@ -0,0 +1,32 @@
+#ifndef SoftWire_BitScan_hpp
+#define SoftWire_BitScan_hpp
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace SoftWire
+{
+	inline int lowestBit(unsigned int mask)   // Mask must not be zero
+	{
+		#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return index;
+		#elif defined(__GNUC__)
+			return __builtin_ctz(mask);
+		#else
+			int n = 0;
+
+			while(!(mask & 1))
+			{
+				mask >>= 1;
+				n++;
+			}
+
+			return n;
+		#endif
+	}
+}
+
+#endif   // SoftWire_BitScan_hpp
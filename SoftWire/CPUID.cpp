@@ -0,0 +1,225 @@
+#include "CPUID.hpp"
+
+#include "Assembler.hpp"
+#include "Instruction.hpp"
+#include "InstructionSet.hpp"
+#include "Error.hpp"
+#include "String.hpp"
+
+namespace SoftWire
+{
+	int CPUID::features = 0;
+	int CPUID::target = 0;
+	bool CPUID::detected = false;
+	bool CPUID::targetSet = false;
+
+	const CPUID::Symbol CPUID::symbolSet[] =
+	{
+		{"fpu",			FPU},
+		{"mmx",			MMX},
+		{"cmov",		CMOV},
+		{"katmai",		MMXEXT},
+		{"sse",			SSE},
+		{"sse2",		SSE2},
+		{"sse3",		SSE3},
+		{"ssse3",		SSSE3},
+		{"sse41",		SSE41},
+		{"sse42",		SSE42},
+		{"popcount",	POPCNT},   // Not 'popcnt', symbols would replace the mnemonic
+		{"abm",			LZCNT},
+		{"bmi1",		BMI1},
+		{"bmi2",		BMI2},
+		{"adx",			ADX},
+		{"avx",			AVX},
+		{"avx2",		AVX2},
+		{"fma",			FMA},
+		{"amd3dnow",	AMD3DNOW},
+		{"athlon",		AMD3DNOWEXT},
+		{"amd",			AMD},
+		{"cyrix",		CYRIX},
+		{"osxsave",		OSXSAVE},
+
+		{0,				0}
+	};
+
+	int CPUID::detect()
+	{
+		if(detected)
+		{
+			return features;
+		}
+
+		detected = true;
+		features = 0;
+
+		// Don't let target checking reject the detection routine itself
+		const bool enforced = InstructionSet::isTargetEnforced();
+		InstructionSet::enforceTarget(false);
+
+		// Assumes a Pentium or later, without testing the EFLAGS ID bit
+		Assembler x86;
+
+		void (*cpuid)(int, int, int*) = 0;
+		int (*xgetbv)(int) = 0;
+
+		try
+		{
+			x86.label("cpuid");
+			x86.push(ebx);
+			x86.push(esi);
+			x86.mov(eax, dword_ptr [esp+12]);
+			x86.mov(ecx, dword_ptr [esp+16]);
+			x86.mov(esi, dword_ptr [esp+20]);
+			x86.cpuid();
+			x86.mov(dword_ptr [esi+0], eax);
+			x86.mov(dword_ptr [esi+4], ebx);
+			x86.mov(dword_ptr [esi+8], ecx);
+			x86.mov(dword_ptr [esi+12], edx);
+			x86.pop(esi);
+			x86.pop(ebx);
+			x86.ret();
+
+			x86.label("xgetbv");
+			x86.mov(ecx, dword_ptr [esp+4]);
+			x86.xgetbv();
+			x86.ret();
+
+			cpuid = (void(*)(int, int, int*))x86.callable("cpuid");
+			xgetbv = (int(*)(int))x86.callable("xgetbv");
+		}
+		catch(...)
+		{
+			InstructionSet::enforceTarget(enforced);
+			throw;
+		}
+
+		InstructionSet::enforceTarget(enforced);
+
+		if(!cpuid || !xgetbv)
+		{
+			return features;
+		}
+
+		int registers[4];   // EAX, EBX, ECX, EDX
+
+		cpuid(0, 0, registers);
+		const int maxFunction = registers[0];
+
+		char vendor[13];
+		memcpy(vendor + 0, &registers[1], 4);
+		memcpy(vendor + 4, &registers[3], 4);
+		memcpy(vendor + 8, &registers[2], 4);
+		vendor[12] = '\0';
+
+		if(strcmp(vendor, "AuthenticAMD") == 0) features |= AMD;
+		if(strcmp(vendor, "CyrixInstead") == 0) features |= CYRIX;
+
+		if(maxFunction >= 1)
+		{
+			cpuid(1, 0, registers);
+			const int ecx = registers[2];
+			const int edx = registers[3];
+
+			if(edx & 0x00000001) features |= FPU;
+			if(edx & 0x00008000) features |= CMOV;
+			if(edx & 0x00800000) features |= MMX;
+			if(edx & 0x02000000) features |= SSE | MMXEXT;
+			if(edx & 0x04000000) features |= SSE2;
+			if(ecx & 0x00000001) features |= SSE3;
+			if(ecx & 0x00000200) features |= SSSE3;
+			if(ecx & 0x00080000) features |= SSE41;
+			if(ecx & 0x00100000) features |= SSE42;
+			if(ecx & 0x00800000) features |= POPCNT;
+
+			if(ecx & 0x08000000) features |= OSXSAVE;
+
+			// AVX state has to be enabled by the operating system
+			if((features & OSXSAVE) && (ecx & 0x10000000) && (xgetbv(0) & 0x00000006) == 0x00000006)
+			{
+				features |= AVX;
+
+				if(ecx & 0x00001000) features |= FMA;
+			}
+		}
+
+		if(maxFunction >= 7)
+		{
+			cpuid(7, 0, registers);
+			const int ebx = registers[1];
+
+			if(ebx & 0x00000008) features |= BMI1;
+			if(ebx & 0x00000100) features |= BMI2;
+			if(ebx & 0x00080000) features |= ADX;
+			if((ebx & 0x00000020) && (features & AVX)) features |= AVX2;
+		}
+
+		cpuid(0x80000000, 0, registers);
+
+		if((unsigned int)registers[0] >= 0x80000001)
+		{
+			cpuid(0x80000001, 0, registers);
+			const int ecx = registers[2];
+			const int edx = registers[3];
+
+			if(ecx & 0x00000020) features |= LZCNT;
+			if(edx & 0x00400000) features |= MMXEXT;
+			if(edx & 0x40000000) features |= AMD3DNOWEXT;
+			if(edx & 0x80000000) features |= AMD3DNOW;
+		}
+
+		return features;
+	}
+
+	int CPUID::getTarget()
+	{
+		if(targetSet)
+		{
+			return target;
+		}
+
+		return detect();
+	}
+
+	void CPUID::setTarget(int features)
+	{
+		target = features;
+		targetSet = true;
+	}
+
+	void CPUID::resetTarget()
+	{
+		targetSet = false;
+	}
+
+	bool CPUID::supports(int features)
+	{
+		return (getTarget() & features) == features;
+	}
+
+	int CPUID::instructionFlags()
+	{
+		const int target = getTarget();
+
+		// System and undocumented instructions are not a matter of processor level
+		int flags = Instruction::CPU_PENTIUM | Instruction::CPU_SMM | Instruction::CPU_UNDOC | Instruction::CPU_PRIV;
+
+		if(target & CMOV)			flags |= Instruction::CPU_P6;
+		if(target & FPU)			flags |= Instruction::CPU_FPU;
+		if(target & MMX)			flags |= Instruction::CPU_MMX;
+		if(target & MMXEXT)			flags |= Instruction::CPU_KATMAI;
+		if(target & SSE)			flags |= Instruction::CPU_SSE;
+		if(target & SSE2)			flags |= Instruction::CPU_SSE2;
+		if(target & POPCNT)			flags |= Instruction::CPU_POPCNT;
+		if(target & LZCNT)			flags |= Instruction::CPU_LZCNT;
+		if(target & BMI1)			flags |= Instruction::CPU_BMI1;
+		if(target & BMI2)			flags |= Instruction::CPU_BMI2;
+		if(target & ADX)			flags |= Instruction::CPU_ADX;
+		if(target & AMD3DNOW)		flags |= Instruction::CPU_3DNOW;
+		if(target & AMD3DNOWEXT)	flags |= Instruction::CPU_ATHLON;
+		if(target & AMD)			flags |= Instruction::CPU_AMD;
+		if(target & CYRIX)			flags |= Instruction::CPU_CYRIX;
+		if(target & OSXSAVE)		flags |= Instruction::CPU_XSAVE;
+
+		return flags;
+	}
+}
@@ -0,0 +1,60 @@
+#ifndef SoftWire_CPUID_hpp
+#define SoftWire_CPUID_hpp
+
+namespace SoftWire
+{
+	class CPUID
+	{
+	public:
+		enum Feature
+		{
+			FPU			= 0x00000001,
+			MMX			= 0x00000002,
+			CMOV		= 0x00000004,
+			MMXEXT		= 0x00000008,   // Integer SSE, also found on Athlon
+			SSE			= 0x00000010,
+			SSE2		= 0x00000020,
+			SSE3		= 0x00000040,
+			SSSE3		= 0x00000080,
+			SSE41		= 0x00000100,
+			SSE42		= 0x00000200,
+			POPCNT		= 0x00000400,
+			LZCNT		= 0x00000800,
+			BMI1		= 0x00001000,
+			BMI2		= 0x00002000,
+			ADX			= 0x00004000,
+			AVX			= 0x00008000,   // Only when the OS saves YMM registers
+			AVX2		= 0x00010000,
+			FMA			= 0x00020000,
+			AMD3DNOW	= 0x00040000,
+			AMD3DNOWEXT	= 0x00080000,
+			AMD			= 0x00100000,   // Vendor
+			CYRIX		= 0x00200000,   // Vendor
+			OSXSAVE		= 0x00400000    // XGETBV, extended state enabled by the OS
+		};
+
+		struct Symbol
+		{
+			const char *name;
+			int features;
+		};
+
+		static int detect();   // Features of the processor we're running on
+		static int getTarget();   // Features code gets generated for
+		static void setTarget(int features);   // Cross-generate for another processor
+		static void resetTarget();
+
+		static bool supports(int features);   // Target has all features
+		static int instructionFlags();   // Instruction::CPU_* flags of target
+
+		static const Symbol symbolSet[];   // Preprocessor symbols, zero terminated
+
+	private:
+		static int features;
+		static int target;
+		static bool detected;
+		static bool targetSet;
+	};
+}
+
+#endif   // SoftWire_CPUID_hpp
@@ -0,0 +1,28 @@
+Table:
+	DD		2
+	DD		3
+	DD		5
+	DD		3 + 9 % 5
+
+Cached:
+	push	esi
+
+	; Sum the first n entries
+	mov		esi, [esp+8]
+	xor		eax, eax
+Absolute:
+	mov		ecx, Table
+Sum:
+	add		eax, [ecx+esi*4-4]
+	dec		esi
+	jnz		Sum
+
+	push	eax
+Relative:
+	call	countCall
+	pop		eax
+
+	pop		esi
+
+	ret
+Finish:
@@ -1,104 +1,92 @@
 #include "CodeGenerator.hpp"
 
+#include "Instruction.hpp"
+#include "InstructionSet.hpp"
+#include "CPUID.hpp"
 #include "Error.hpp"
+#include "BitScan.hpp"
+
+#include <string.h>
 
 namespace SoftWire
 {
 	CodeGenerator::CodeGenerator()
 	{
-		physicalEAX = 0;
-		physicalECX = 0;
-		physicalEDX = 0;
-		physicalEBX = 0;
-		physicalESI = 0;
-		physicalEDI = 0;
-
-		physicalMM0 = 0;
-		physicalMM1 = 0;
-		physicalMM2 = 0;
-		physicalMM3 = 0;
-		physicalMM4 = 0;
-		physicalMM5 = 0;
-		physicalMM6 = 0;
-		physicalMM7 = 0;
-
-		physicalXMM0 = 0;
-		physicalXMM1 = 0;
-		physicalXMM2 = 0;
-		physicalXMM3 = 0;
-		physicalXMM4 = 0;
-		physicalXMM5 = 0;
-		physicalXMM6 = 0;
-		physicalXMM7 = 0;
-
-		priorityEAX = 0;
-		priorityECX = 0;
-		priorityEDX = 0;
-		priorityEBX = 0;
-		priorityESI = 0;
-		priorityEDI = 0;
-
-		priorityMM0 = 0;
-		priorityMM1 = 0;
-		priorityMM2 = 0;
-		priorityMM3 = 0;
-		priorityMM4 = 0;
-		priorityMM5 = 0;
-		priorityMM6 = 0;
-		priorityMM7 = 0;
-
-		priorityXMM0 = 0;
-		priorityXMM1 = 0;
-		priorityXMM2 = 0;
-		priorityXMM3 = 0;
-		priorityXMM4 = 0;
-		priorityXMM5 = 0;
-		priorityXMM6 = 0;
-		priorityXMM7 = 0;
+		static const unsigned int available[3] =
+		{
+			1 << Encoding::EAX | 1 << Encoding::ECX | 1 << Encoding::EDX | 1 << Encoding::EBX | 1 << Encoding::ESI | 1 << Encoding::EDI,
+			0xFF,
+			0xFF
+		};
+
+		for(int f = 0; f < 3; f++)
+		{
+			RegisterFile &file = registerFile[f];
+
+			file.count = 8;
+			file.available = available[f];
+			file.allocated = 0;
+			file.dirty = 0;
+			file.stacked = 0;
+			file.cached = 0;
+
+			for(int r = 0; r < MAX_REGISTERS; r++)
+			{
+				file.physical[r] = 0;
+				file.priority[r] = 0;
+			}
+		}
+
+		framed = false;
+		touched = 0;
+		called = false;
+		slotted = false;
+		argued = false;
+
+		for(int i = 0; i < (int)(sizeof(frameCode) / sizeof(frameCode[0])); i++)
+		{
+			frameCode[i] = 0;
+		}
+
+		autoEmms = true;
+		mmxWarnings = false;
+		mmxState = false;
+		mmxUsed = false;
+		defined = new DefinedList();
+		openLabels = false;
+
+		resetStatistics();
+
+		recording = false;
+		virtuals = 0;
+		virtualTail = 0;
+		recorded = 0;
+		numVirtuals = 0;
+		numRecorded = 0;
 	}
 
-	const OperandREG32 &CodeGenerator::r32(const OperandREF &ref, bool copy)
+	CodeGenerator::~CodeGenerator()
 	{
-		if(ref == 0 && copy) throw Error("Cannot dereference 0");
+		discardRecording();
 
-		// Check if already allocated
-		     if(physicalEAX == ref) return access(eax);
-		else if(physicalECX == ref) return access(ecx);
-		else if(physicalEDX == ref) return access(edx);
-		else if(physicalEBX == ref) return access(ebx);
-		else if(physicalESI == ref) return access(esi);
-		else if(physicalEDI == ref) return access(edi);
+		for(DefinedList *d = defined; d && d->next(); d = d->next())
+		{
+			delete[] d->label;
+		}
 
-		// Search for free registers
-		     if(physicalEAX == 0 && priorityEAX == 0) return assign(eax, ref, copy);
-		else if(physicalECX == 0 && priorityECX == 0) return assign(ecx, ref, copy);
-		else if(physicalEDX == 0 && priorityEDX == 0) return assign(edx, ref, copy);
-		else if(physicalEBX == 0 && priorityEBX == 0) return assign(ebx, ref, copy);
-		else if(physicalESI == 0 && priorityESI == 0) return assign(esi, ref, copy);
-		else if(physicalEDI == 0 && priorityEDI == 0) return assign(edi, ref, copy);
+		delete defined;
+	}
 
-		// Need to spill one
-		Encoding::Reg candidate = Encoding::REG_UNKNOWN;
-		unsigned int priority = 0xFFFFFFFF;
+	const OperandREG32 &CodeGenerator::r32(const OperandREF &ref, bool copy)
+	{
+		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
-		if(priorityEAX < priority && real(physicalEAX)) {priority = priorityEAX; candidate = Encoding::EAX;}
-		if(priorityECX < priority && real(physicalECX)) {priority = priorityECX; candidate = Encoding::ECX;}
-		if(priorityEDX < priority && real(physicalEDX)) {priority = priorityEDX; candidate = Encoding::EDX;}
-		if(priorityEBX < priority && real(physicalEBX)) {priority = priorityEBX; candidate = Encoding::EBX;}
-		if(priorityESI < priority && real(physicalESI)) {priority = priorityESI; candidate = Encoding::ESI;}
-		if(priorityEDI < priority && real(physicalEDI)) {priority = priorityEDI; candidate = Encoding::EDI;}
-
-		switch(candidate)
-		{
-		case Encoding::REG_UNKNOWN: throw Error("Out of physical general purpose registers. Use free().");
-		case Encoding::EAX: spill(eax); return assign(eax, ref, copy);
-		case Encoding::ECX: spill(ecx); return assign(ecx, ref, copy);
-		case Encoding::EDX: spill(edx); return assign(edx, ref, copy);
-		case Encoding::EBX: spill(ebx); return assign(ebx, ref, copy);
-		case Encoding::ESI: spill(esi); return assign(esi, ref, copy);
-		case Encoding::EDI: spill(edi); return assign(edi, ref, copy);
-		default: throw INTERNAL_ERROR;
+		if(recording)
+		{
+			return virtualRegister(ref, 0, copy).reg32;
 		}
+
+		return operand32(allocateRegister(0, ref, copy));
 	}
 
 	const OperandREG32 &CodeGenerator::x32(const OperandREF &ref, bool copy)
@@ -117,15 +105,18 @@ namespace SoftWire
 	{
 		if(ref == 0) throw Error("Cannot dereference 0");
 
-		// Check if already allocated
-		     if(physicalEAX == ref) return access(eax);
-		else if(physicalECX == ref) return access(ecx);
-		else if(physicalEDX == ref) return access(edx);
-		else if(physicalEBX == ref) return access(ebx);
-		else if(physicalESI == ref) return access(esi);
-		else if(physicalEDI == ref) return access(edi);
+		if(recording)
+		{
+			Virtual *v = findVirtual(ref, 0);
+
+			if(v) return v->reg32;
+			else  return dword_ptr [ref];
+		}
+
+		const int r = findRegister(0, ref);
 
-		return dword_ptr [ref];
+		if(r >= 0) return operand32(accessRegister(0, r));
+		else       return dword_ptr [ref];
 	}
 
 	const OperandREG32 &CodeGenerator::allocate(const OperandREG32 &reg, const OperandREF &ref, bool copy)
@@ -135,141 +126,50 @@ namespace SoftWire
 
 	const OperandREG32 &CodeGenerator::assign(const OperandREG32 &reg, const OperandREF &ref, bool copy)
 	{
-		switch(reg.reg)
-		{
-		case Encoding::EAX:
-			if(physicalEAX != 0) throw Error("eax not available for register allocation");
-			physicalEAX = ref;
-			priorityEAX = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(eax, dword_ptr [ref]);
-			return access(eax);
-		case Encoding::ECX:
-			if(physicalECX != 0) throw Error("ecx not available for register allocation");
-			physicalECX = ref;
-			priorityECX = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(ecx, dword_ptr [ref]);
-			return access(ecx);
-		case Encoding::EDX:
-			if(physicalEDX != 0) throw Error("edx not available for register allocation");
-			physicalEDX = ref;
-			priorityEDX = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(edx, dword_ptr [ref]);
-			return access(edx);
-		case Encoding::EBX:
-			if(physicalEBX != 0) throw Error("ebx not available for register allocation");
-			physicalEBX = ref;
-			priorityEBX = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(ebx, dword_ptr [ref]);
-			return access(ebx);
-		case Encoding::ESI:
-			if(physicalESI != 0) throw Error("esi not available for register allocation");
-			physicalESI = ref;
-			priorityESI = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(esi, dword_ptr [ref]);
-			return access(esi);
-		case Encoding::EDI:
-			if(physicalEDI != 0) throw Error("edi not available for register allocation");
-			physicalEDI = ref;
-			priorityEDI = 0xFFFFFFFF;
-			if(copy && real(ref)) mov(edi, dword_ptr [ref]);
-			return access(edi);
-		default: throw INTERNAL_ERROR;
-		}
+		if(recording) throw Error("Cannot assign physical registers while recording");
+
+		return operand32(assignRegister(0, reg.reg, ref, copy));
 	}
 
 	const OperandREG32 &CodeGenerator::access(const OperandREG32 &reg)
 	{
-		// Decrease priority of other registers
-		if(reg.reg != Encoding::EAX && priorityEAX) priorityEAX--;
-		if(reg.reg != Encoding::ECX && priorityECX) priorityECX--;
-		if(reg.reg != Encoding::EDX && priorityEDX) priorityEDX--;
-		if(reg.reg != Encoding::EBX && priorityEBX) priorityEBX--;
-		if(reg.reg != Encoding::ESI && priorityESI) priorityESI--;
-		if(reg.reg != Encoding::EDI && priorityEDI) priorityEDI--;
+		accessRegister(0, reg.reg);
 
 		return reg;
 	}
 
 	void CodeGenerator::free(const OperandREG32 &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::EAX: physicalEAX = 0; priorityEAX = 0; break;
-		case Encoding::ECX: physicalECX = 0; priorityECX = 0; break;
-		case Encoding::EDX: physicalEDX = 0; priorityEDX = 0; break;
-		case Encoding::EBX: physicalEBX = 0; priorityEBX = 0; break;
-		case Encoding::ESI: physicalESI = 0; priorityESI = 0; break;
-		case Encoding::EDI: physicalEDI = 0; priorityEDI = 0; break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), false);
+			return;
 		}
+
+		freeRegister(0, reg.reg);
 	}
 
 	void CodeGenerator::spill(const OperandREG32 &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::EAX: if(real(physicalEAX)) mov(dword_ptr [physicalEAX], eax); break;
-		case Encoding::ECX: if(real(physicalECX)) mov(dword_ptr [physicalECX], ecx); break;
-		case Encoding::EDX: if(real(physicalEDX)) mov(dword_ptr [physicalEDX], edx); break;
-		case Encoding::EBX: if(real(physicalEBX)) mov(dword_ptr [physicalEBX], ebx); break;
-		case Encoding::ESI: if(real(physicalESI)) mov(dword_ptr [physicalESI], esi); break;
-		case Encoding::EDI: if(real(physicalEDI)) mov(dword_ptr [physicalEDI], edi); break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), true);
+			return;
 		}
 
-		free(reg);
+		spillRegister(0, reg.reg);
 	}
 
 	const OperandMMREG &CodeGenerator::r64(const OperandREF &ref, bool copy)
 	{
 		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
-		// Check if already allocated
-		     if(physicalMM0 == ref) return access(mm0);
-		else if(physicalMM1 == ref) return access(mm1);
-		else if(physicalMM2 == ref) return access(mm2);
-		else if(physicalMM3 == ref) return access(mm3);
-		else if(physicalMM4 == ref) return access(mm4);
-		else if(physicalMM5 == ref) return access(mm5);
-		else if(physicalMM6 == ref) return access(mm6);
-		else if(physicalMM7 == ref) return access(mm7);
-
-		// Search for free registers
-		     if(physicalMM0 == 0 && priorityMM0 == 0) return assign(mm0, ref, copy);
-		else if(physicalMM1 == 0 && priorityMM1 == 0) return assign(mm1, ref, copy);
-		else if(physicalMM2 == 0 && priorityMM2 == 0) return assign(mm2, ref, copy);
-		else if(physicalMM3 == 0 && priorityMM3 == 0) return assign(mm3, ref, copy);
-		else if(physicalMM4 == 0 && priorityMM4 == 0) return assign(mm4, ref, copy);
-		else if(physicalMM5 == 0 && priorityMM5 == 0) return assign(mm5, ref, copy);
-		else if(physicalMM6 == 0 && priorityMM6 == 0) return assign(mm6, ref, copy);
-		else if(physicalMM7 == 0 && priorityMM7 == 0) return assign(mm7, ref, copy);
-
-		// Need to spill one
-		Encoding::Reg candidate = Encoding::REG_UNKNOWN;
-		unsigned int priority = 0xFFFFFFFF;
-
-		if(priorityMM0 < priority && real(physicalMM0)) {priority = priorityMM0; candidate = Encoding::MM0;}
-		if(priorityMM1 < priority && real(physicalMM1)) {priority = priorityMM1; candidate = Encoding::MM1;}
-		if(priorityMM2 < priority && real(physicalMM2)) {priority = priorityMM2; candidate = Encoding::MM2;}
-		if(priorityMM3 < priority && real(physicalMM3)) {priority = priorityMM3; candidate = Encoding::MM3;}
-		if(priorityMM4 < priority && real(physicalMM4)) {priority = priorityMM4; candidate = Encoding::MM4;}
-		if(priorityMM5 < priority && real(physicalMM5)) {priority = priorityMM5; candidate = Encoding::MM5;}
-		if(priorityMM6 < priority && real(physicalMM6)) {priority = priorityMM6; candidate = Encoding::MM6;}
-		if(priorityMM7 < priority && real(physicalMM7)) {priority = priorityMM7; candidate = Encoding::MM7;}
-
-		switch(candidate)
-		{
-		case Encoding::REG_UNKNOWN: throw Error("Out of physical MMX registers. Use free().");
-		case Encoding::MM0: spill(mm0); return assign(mm0, ref, copy);
-		case Encoding::MM1: spill(mm1); return assign(mm1, ref, copy);
-		case Encoding::MM2: spill(mm2); return assign(mm2, ref, copy);
-		case Encoding::MM3: spill(mm3); return assign(mm3, ref, copy);
-		case Encoding::MM4: spill(mm4); return assign(mm4, ref, copy);
-		case Encoding::MM5: spill(mm5); return assign(mm5, ref, copy);
-		case Encoding::MM6: spill(mm6); return assign(mm6, ref, copy);
-		case Encoding::MM7: spill(mm7); return assign(mm7, ref, copy);
-		default: throw INTERNAL_ERROR;
+		if(recording)
+		{
+			return virtualRegister(ref, 1, copy).reg64;
 		}
+
+		return operand64(allocateRegister(1, ref, copy));
 	}
 
 	const OperandMMREG &CodeGenerator::x64(const OperandREF &ref, bool copy)
@@ -288,17 +188,18 @@ namespace SoftWire
 	{
 		if(ref == 0) throw Error("Cannot dereference 0");
 
-		// Check if already allocated
-		     if(physicalMM0 == ref) return access(mm0);
-		else if(physicalMM1 == ref) return access(mm1);
-		else if(physicalMM2 == ref) return access(mm2);
-		else if(physicalMM3 == ref) return access(mm3);
-		else if(physicalMM4 == ref) return access(mm4);
-		else if(physicalMM5 == ref) return access(mm5);
-		else if(physicalMM6 == ref) return access(mm6);
-		else if(physicalMM7 == ref) return access(mm7);
+		if(recording)
+		{
+			Virtual *v = findVirtual(ref, 1);
+
+			if(v) return v->reg64;
+			else  return qword_ptr [ref];
+		}
+
+		const int r = findRegister(1, ref);
 
-		return qword_ptr [ref];
+		if(r >= 0) return operand64(accessRegister(1, r));
+		else       return qword_ptr [ref];
 	}
 
 	const OperandMMREG &CodeGenerator::allocate(const OperandMMREG &reg, const OperandREF &ref, bool copy)
@@ -308,159 +209,50 @@ namespace SoftWire
 
 	const OperandMMREG &CodeGenerator::assign(const OperandMMREG &reg, const OperandREF &ref, bool copy)
 	{
-		switch(reg.reg)
-		{
-		case Encoding::MM0:
-			if(physicalMM0 != 0) throw Error("mm0 not available for register allocation");
-			physicalMM0 = ref;
-			priorityMM0 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm0, qword_ptr [ref]);
-			return access(mm0);
-		case Encoding::MM1:
-			if(physicalMM1 != 0) throw Error("mm1 not available for register allocation");
-			physicalMM1 = ref;
-			priorityMM1 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm1, qword_ptr [ref]);
-			return access(mm1);
-		case Encoding::MM2:
-			if(physicalMM2 != 0) throw Error("mm2 not available for register allocation");
-			physicalMM2 = ref;
-			priorityMM2 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm2, qword_ptr [ref]);
-			return access(mm2);
-		case Encoding::MM3:
-			if(physicalMM3 != 0) throw Error("mm3 not available for register allocation");
-			physicalMM3 = ref;
-			priorityMM3 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm3, qword_ptr [ref]);
-			return access(mm3);
-		case Encoding::MM4:
-			if(physicalMM4 != 0) throw Error("mm4 not available for register allocation");
-			physicalMM4 = ref;
-			priorityMM4 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm4, qword_ptr [ref]);
-			return access(mm4);
-		case Encoding::MM5:
-			if(physicalMM5 != 0) throw Error("mm5 not available for register allocation");
-			physicalMM5 = ref;
-			priorityMM5 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm5, qword_ptr [ref]);
-			return access(mm5);
-		case Encoding::MM6:
-			if(physicalMM6 != 0) throw Error("mm6 not available for register allocation");
-			physicalMM6 = ref;
-			priorityMM6 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm6, qword_ptr [ref]);
-			return access(mm6);
-		case Encoding::MM7:
-			if(physicalMM7 != 0) throw Error("mm7 not available for register allocation");
-			physicalMM7 = ref;
-			priorityMM7 = 0xFFFFFFFF;
-			if(copy && real(ref)) movq(mm7, qword_ptr [ref]);
-			return access(mm7);
-		default: throw INTERNAL_ERROR;
-		}
+		if(recording) throw Error("Cannot assign physical registers while recording");
+
+		return operand64(assignRegister(1, reg.reg, ref, copy));
 	}
 
 	const OperandMMREG &CodeGenerator::access(const OperandMMREG &reg)
 	{
-		// Decrease priority of other registers
-		if(reg.reg != Encoding::MM0 && priorityMM0) priorityMM0--;
-		if(reg.reg != Encoding::MM1 && priorityMM1) priorityMM1--;
-		if(reg.reg != Encoding::MM2 && priorityMM2) priorityMM2--;
-		if(reg.reg != Encoding::MM3 && priorityMM3) priorityMM3--;
-		if(reg.reg != Encoding::MM4 && priorityMM4) priorityMM4--;
-		if(reg.reg != Encoding::MM5 && priorityMM5) priorityMM5--;
-		if(reg.reg != Encoding::MM6 && priorityMM6) priorityMM6--;
-		if(reg.reg != Encoding::MM7 && priorityMM7) priorityMM7--;
+		accessRegister(1, reg.reg);
 
 		return reg;
 	}
 
 	void CodeGenerator::free(const OperandMMREG &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::MM0: physicalMM0 = 0; priorityMM0 = 0; break;
-		case Encoding::MM1: physicalMM1 = 0; priorityMM1 = 0; break;
-		case Encoding::MM2: physicalMM2 = 0; priorityMM2 = 0; break;
-		case Encoding::MM3: physicalMM3 = 0; priorityMM3 = 0; break;
-		case Encoding::MM4: physicalMM4 = 0; priorityMM4 = 0; break;
-		case Encoding::MM5: physicalMM5 = 0; priorityMM5 = 0; break;
-		case Encoding::MM6: physicalMM6 = 0; priorityMM6 = 0; break;
-		case Encoding::MM7: physicalMM7 = 0; priorityMM7 = 0; break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), false);
+			return;
 		}
+
+		freeRegister(1, reg.reg);
 	}
 
 	void CodeGenerator::spill(const OperandMMREG &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::MM0: if(real(physicalMM0)) movq(qword_ptr [physicalMM0], mm0); break;
-		case Encoding::MM1: if(real(physicalMM1)) movq(qword_ptr [physicalMM1], mm1); break;
-		case Encoding::MM2: if(real(physicalMM2)) movq(qword_ptr [physicalMM2], mm2); break;
-		case Encoding::MM3: if(real(physicalMM3)) movq(qword_ptr [physicalMM3], mm3); break;
-		case Encoding::MM4: if(real(physicalMM4)) movq(qword_ptr [physicalMM4], mm4); break;
-		case Encoding::MM5: if(real(physicalMM5)) movq(qword_ptr [physicalMM5], mm5); break;
-		case Encoding::MM6: if(real(physicalMM6)) movq(qword_ptr [physicalMM6], mm6); break;
-		case Encoding::MM7: if(real(physicalMM7)) movq(qword_ptr [physicalMM7], mm7); break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), true);
+			return;
 		}
 
-		free(reg);
+		spillRegister(1, reg.reg);
 	}
 
 	const OperandXMMREG &CodeGenerator::r128(const OperandREF &ref, bool copy)
 	{
 		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
-		// Check if already allocated
-		     if(physicalXMM0 == ref) return access(xmm0);
-		else if(physicalXMM1 == ref) return access(xmm1);
-		else if(physicalXMM2 == ref) return access(xmm2);
-		else if(physicalXMM3 == ref) return access(xmm3);
-		else if(physicalXMM4 == ref) return access(xmm4);
-		else if(physicalXMM5 == ref) return access(xmm5);
-		else if(physicalXMM6 == ref) return access(xmm6);
-		else if(physicalXMM7 == ref) return access(xmm7);
-
-		// Search for free registers
-		     if(physicalXMM0 == 0 && priorityXMM0 == 0) return assign(xmm0, ref, copy);
-		else if(physicalXMM1 == 0 && priorityXMM1 == 0) return assign(xmm1, ref, copy);
-		else if(physicalXMM2 == 0 && priorityXMM2 == 0) return assign(xmm2, ref, copy);
-		else if(physicalXMM3 == 0 && priorityXMM3 == 0) return assign(xmm3, ref, copy);
-		else if(physicalXMM4 == 0 && priorityXMM4 == 0) return assign(xmm4, ref, copy);
-		else if(physicalXMM5 == 0 && priorityXMM5 == 0) return assign(xmm5, ref, copy);
-		else if(physicalXMM6 == 0 && priorityXMM6 == 0) return assign(xmm6, ref, copy);
-		else if(physicalXMM7 == 0 && priorityXMM7 == 0) return assign(xmm7, ref, copy);
-
-		// Need to spill one
-		Encoding::Reg candidate = Encoding::REG_UNKNOWN;
-		unsigned int priority = 0xFFFFFFFF;
-
-		if(priorityXMM0 < priority && real(physicalXMM0)) {priority = priorityXMM0; candidate = Encoding::XMM0;}
-		if(priorityXMM1 < priority && real(physicalXMM1)) {priority = priorityXMM1; candidate = Encoding::XMM1;}
-		if(priorityXMM2 < priority && real(physicalXMM2)) {priority = priorityXMM2; candidate = Encoding::XMM2;}
-		if(priorityXMM3 < priority && real(physicalXMM3)) {priority = priorityXMM3; candidate = Encoding::XMM3;}
-		if(priorityXMM4 < priority && real(physicalXMM4)) {priority = priorityXMM4; candidate = Encoding::XMM4;}
-		if(priorityXMM5 < priority && real(physicalXMM5)) {priority = priorityXMM5; candidate = Encoding::XMM5;}
-		if(priorityXMM6 < priority && real(physicalXMM6)) {priority = priorityXMM6; candidate = Encoding::XMM6;}
-		if(priorityXMM7 < priority && real(physicalXMM7)) {priority = priorityXMM7; candidate = Encoding::XMM7;}
-
-		switch(candidate)
-		{
-		case Encoding::REG_UNKNOWN: throw Error("Out of physical SSE registers. Use free().");
-		case Encoding::XMM0: spill(xmm0); return assign(xmm0, ref, copy);
-		case Encoding::XMM1: spill(xmm1); return assign(xmm1, ref, copy);
-		case Encoding::XMM2: spill(xmm2); return assign(xmm2, ref, copy);
-		case Encoding::XMM3: spill(xmm3); return assign(xmm3, ref, copy);
-		case Encoding::XMM4: spill(xmm4); return assign(xmm4, ref, copy);
-		case Encoding::XMM5: spill(xmm5); return assign(xmm5, ref, copy);
-		case Encoding::XMM6: spill(xmm6); return assign(xmm6, ref, copy);
-		case Encoding::XMM7: spill(xmm7); return assign(xmm7, ref, copy);
-		default: throw INTERNAL_ERROR;
+		if(recording)
+		{
+			return virtualRegister(ref, 2, copy).reg128;
 		}
+
+		return operand128(allocateRegister(2, ref, copy));
 	}
 
 	const OperandXMMREG &CodeGenerator::x128(const OperandREF &ref, bool copy)
@@ -479,17 +271,18 @@ namespace SoftWire
 	{
 		if(ref == 0) throw Error("Cannot dereference 0");
 
-		// Check if already allocated
-		     if(physicalXMM0 == ref) return access(xmm0);
-		else if(physicalXMM1 == ref) return access(xmm1);
-		else if(physicalXMM2 == ref) return access(xmm2);
-		else if(physicalXMM3 == ref) return access(xmm3);
-		else if(physicalXMM4 == ref) return access(xmm4);
-		else if(physicalXMM5 == ref) return access(xmm5);
-		else if(physicalXMM6 == ref) return access(xmm6);
-		else if(physicalXMM7 == ref) return access(xmm7);
+		if(recording)
+		{
+			Virtual *v = findVirtual(ref, 2);
+
+			if(v) return v->reg128;
+			else  return xword_ptr [ref];
+		}
+
+		const int r = findRegister(2, ref);
 
-		return xword_ptr [ref];
+		if(r >= 0) return operand128(accessRegister(2, r));
+		else       return xword_ptr [ref];
 	}
 
 	const OperandXMMREG &CodeGenerator::allocate(const OperandXMMREG &reg, const OperandREF &ref, bool copy)
@@ -499,107 +292,38 @@ namespace SoftWire
 
 	const OperandXMMREG &CodeGenerator::assign(const OperandXMMREG &reg, const OperandREF &ref, bool copy)
 	{
-		switch(reg.reg)
-		{
-		case Encoding::XMM0:
-			if(physicalXMM0 != 0) throw Error("xmm0 not available for register allocation");
-			physicalXMM0 = ref;
-			priorityXMM0 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm0, xword_ptr [ref]);
-			return access(xmm0);
-		case Encoding::XMM1:
-			if(physicalXMM1 != 0) throw Error("xmm1 not available for register allocation");
-			physicalXMM1 = ref;
-			priorityXMM1 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm1, xword_ptr [ref]);
-			return access(xmm1);
-		case Encoding::XMM2:
-			if(physicalXMM2 != 0) throw Error("xmm2 not available for register allocation");
-			physicalXMM2 = ref;
-			priorityXMM2 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm2, xword_ptr [ref]);
-			return access(xmm2);
-		case Encoding::XMM3:
-			if(physicalXMM3 != 0) throw Error("xmm3 not available for register allocation");
-			physicalXMM3 = ref;
-			priorityXMM3 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm3, xword_ptr [ref]);
-			return access(xmm3);
-		case Encoding::XMM4:
-			if(physicalXMM4 != 0) throw Error("xmm4 not available for register allocation");
-			physicalXMM4 = ref;
-			priorityXMM4 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm4, xword_ptr [ref]);
-			return access(xmm4);
-		case Encoding::XMM5:
-			if(physicalXMM5 != 0) throw Error("xmm5 not available for register allocation");
-			physicalXMM5 = ref;
-			priorityXMM5 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm5, xword_ptr [ref]);
-			return access(xmm5);
-		case Encoding::XMM6:
-			if(physicalXMM6 != 0) throw Error("xmm6 not available for register allocation");
-			physicalXMM6 = ref;
-			priorityXMM6 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm6, xword_ptr [ref]);
-			return access(xmm6);
-		case Encoding::XMM7:
-			if(physicalXMM7 != 0) throw Error("xmm7 not available for register allocation");
-			physicalXMM7 = ref;
-			priorityXMM7 = 0xFFFFFFFF;
-			if(copy && real(ref)) movaps(xmm7, xword_ptr [ref]);
-			return access(xmm7);
-		default: throw INTERNAL_ERROR;
-		}
+		if(recording) throw Error("Cannot assign physical registers while recording");
+
+		return operand128(assignRegister(2, reg.reg, ref, copy));
 	}
 
 	const OperandXMMREG &CodeGenerator::access(const OperandXMMREG &reg)
 	{
-		// Decrease priority of other registers
-		if(reg.reg != Encoding::XMM0 && priorityXMM0) priorityXMM0--;
-		if(reg.reg != Encoding::XMM1 && priorityXMM1) priorityXMM1--;
-		if(reg.reg != Encoding::XMM2 && priorityXMM2) priorityXMM2--;
-		if(reg.reg != Encoding::XMM3 && priorityXMM3) priorityXMM3--;
-		if(reg.reg != Encoding::XMM4 && priorityXMM4) priorityXMM4--;
-		if(reg.reg != Encoding::XMM5 && priorityXMM5) priorityXMM5--;
-		if(reg.reg != Encoding::XMM6 && priorityXMM6) priorityXMM6--;
-		if(reg.reg != Encoding::XMM7 && priorityXMM7) priorityXMM7--;
+		accessRegister(2, reg.reg);
 
 		return reg;
 	}
 
 	void CodeGenerator::free(const OperandXMMREG &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::XMM0: physicalXMM0 = 0; priorityXMM0 = 0; break;
-		case Encoding::XMM1: physicalXMM1 = 0; priorityXMM1 = 0; break;
-		case Encoding::XMM2: physicalXMM2 = 0; priorityXMM2 = 0; break;
-		case Encoding::XMM3: physicalXMM3 = 0; priorityXMM3 = 0; break;
-		case Encoding::XMM4: physicalXMM4 = 0; priorityXMM4 = 0; break;
-		case Encoding::XMM5: physicalXMM5 = 0; priorityXMM5 = 0; break;
-		case Encoding::XMM6: physicalXMM6 = 0; priorityXMM6 = 0; break;
-		case Encoding::XMM7: physicalXMM7 = 0; priorityXMM7 = 0; break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), false);
+			return;
 		}
+
+		freeRegister(2, reg.reg);
 	}
 
 	void CodeGenerator::spill(const OperandXMMREG &reg)
 	{
-		switch(reg.reg)
+		if(recording)
 		{
-		case Encoding::XMM0: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM0], xmm0); break;
-		case Encoding::XMM1: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM1], xmm1); break;
-		case Encoding::XMM2: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM2], xmm2); break;
-		case Encoding::XMM3: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM3], xmm3); break;
-		case Encoding::XMM4: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM4], xmm4); break;
-		case Encoding::XMM5: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM5], xmm5); break;
-		case Encoding::XMM6: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM6], xmm6); break;
-		case Encoding::XMM7: if(real(physicalXMM0)) movaps(xword_ptr [physicalXMM7], xmm7); break;
-		default: throw INTERNAL_ERROR;
+			release(virtualIndex(reg.reg), true);
+			return;
 		}
 
-		free(reg);
+		spillRegister(2, reg.reg);
 	}
 
 	bool CodeGenerator::real(const OperandREF &ref)
@@ -610,99 +334,2125 @@ namespace SoftWire
 		       ref.displacement >= 8;
 	}
 
+	void CodeGenerator::prologue()
+	{
+		if(recording) throw Error("Cannot set up the stack frame while recording");
+		if(framed) throw Error("Stack frame already set up");
+
+		// All of it is emitted, the epilogue removes what the routine didn't need
+		Encoding **code = frameCode;
+
+		push(ebp);									*code++ = lastEncoding();
+		mov(ebp, esp);								*code++ = lastEncoding();
+		push(ebx);									*code++ = lastEncoding();
+		push(esi);									*code++ = lastEncoding();
+		push(edi);									*code++ = lastEncoding();
+		sub(esp, FRAME_SIZE + 12);					*code++ = lastEncoding();   // Room for the slots whichever registers stay saved
+		and(esp, -FRAME_ALIGNMENT);					*code++ = lastEncoding();   // Calls need 16-byte alignment on System V
+
+		invalidateLoads();
+		resetStatistics();
+
+		framed = true;
+		touched = 0;
+		called = false;
+		slotted = false;
+		argued = false;
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].stacked = 0;
+		}
+	}
+
+	void CodeGenerator::epilogue()
+	{
+		if(recording) throw Error("Cannot remove the stack frame while recording");
+		if(!framed) throw Error("No stack frame set up");
+
+		static const Encoding::Reg saved[3] = {Encoding::EBX, Encoding::ESI, Encoding::EDI};
+
+		const unsigned int written = touched;
+		const bool frame = slotted || called;
+
+		if((frame || argued) && written & 1 << Encoding::EBP)
+		{
+			throw Error("Routine overwrote ebp, which holds its stack frame");
+		}
+
+		invalidateLoads();
+
+		int kept = 0;
+
+		for(int i = 0; i < 3; i++)
+		{
+			if(written & 1 << saved[i]) kept++;
+		}
+
+		if(frame)
+		{
+			if(kept)
+			{
+				lea(esp, dword_ptr [ebp-4*kept]);
+			}
+			else
+			{
+				mov(esp, ebp);
+			}
+		}
+		else
+		{
+			frameCode[5]->reset();
+			frameCode[6]->reset();
+		}
+
+		for(int i = 2; i >= 0; i--)
+		{
+			if(written & 1 << saved[i])
+			{
+				pop(operand32(saved[i]));
+			}
+			else
+			{
+				frameCode[2 + i]->reset();
+			}
+		}
+
+		if(frame || argued)
+		{
+			pop(ebp);
+		}
+		else if(written & 1 << Encoding::EBP)
+		{
+			pop(ebp);   // Only saved for the caller
+			frameCode[1]->reset();
+		}
+		else
+		{
+			frameCode[0]->reset();
+			frameCode[1]->reset();
+		}
+
+		invalidateLoads();
+		annotateStatistics();
+
+		framed = false;
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].stacked = 0;
+		}
+	}
+
+	const OperandMEM32 CodeGenerator::argument(int i)
+	{
+		if(!framed) throw Error("Arguments are addressed through the stack frame, call prologue() first");
+
+		argued = true;
+
+		return dword_ptr [ebp+8+4*i];
+	}
+
+	bool CodeGenerator::temporary(const OperandREF &ref)
+	{
+		return !real(ref) && ref.displacement >= 0;
+	}
+
+	bool CodeGenerator::spillable(const OperandREF &ref)
+	{
+		return real(ref) || (framed && temporary(ref));
+	}
+
+	const OperandREF CodeGenerator::address(int file, const OperandREF &ref)
+	{
+		// Slots of SSE temporaries first, below the saved registers
+		static const int offset[3] = {8 * 16 + 8 * 8, 8 * 16, 0};
+		static const int size[3] = {4, 8, 16};
+
+		if(real(ref))
+		{
+			return ref;
+		}
+
+		if(!framed || !temporary(ref) || file < 0 || file >= 3) throw INTERNAL_ERROR;
+
+		OperandREF slot;
+
+		slotted = true;
+		slot.baseReg = Encoding::EBP;
+		slot.displacement = -12 - FRAME_SIZE + offset[file] + size[file] * ref.displacement;
+
+		return slot;
+	}
+
 	void CodeGenerator::free(const OperandREF &ref)
 	{
-		     if(physicalEAX == ref) free(eax);
-		else if(physicalECX == ref) free(ecx);
-		else if(physicalEDX == ref) free(edx);
-		else if(physicalEBX == ref) free(ebx);
-		else if(physicalESI == ref) free(esi);
-		else if(physicalEDI == ref) free(edi);
+		if(recording)
+		{
+			release(ref, false);
+			return;
+		}
+
+		for(int f = 0; f < 3; f++)
+		{
+			const int r = findRegister(f, ref);
 
-		else if(physicalMM0 == ref) free(mm0);
-		else if(physicalMM1 == ref) free(mm1);
-		else if(physicalMM2 == ref) free(mm2);
-		else if(physicalMM3 == ref) free(mm3);
-		else if(physicalMM4 == ref) free(mm4);
-		else if(physicalMM5 == ref) free(mm5);
-		else if(physicalMM6 == ref) free(mm6);
-		else if(physicalMM7 == ref) free(mm7);
+			if(r >= 0) freeRegister(f, r);
+			else if(temporary(ref)) registerFile[f].stacked &= ~(1 << ref.displacement);
+		}
 	}
 
 	void CodeGenerator::spill(const OperandREF &ref)
 	{
-		     if(physicalEAX == ref) mov(dword_ptr [physicalEAX], eax);
-		else if(physicalECX == ref) mov(dword_ptr [physicalECX], ecx);
-		else if(physicalEDX == ref) mov(dword_ptr [physicalEDX], edx);
-		else if(physicalEBX == ref) mov(dword_ptr [physicalEBX], ebx);
-		else if(physicalESI == ref) mov(dword_ptr [physicalESI], esi);
-		else if(physicalEDI == ref) mov(dword_ptr [physicalEDI], edi);
+		if(recording)
+		{
+			release(ref, true);
+			return;
+		}
 
-		else if(physicalMM0 == ref) movq(qword_ptr [physicalMM0], mm0);
-		else if(physicalMM1 == ref) movq(qword_ptr [physicalMM1], mm1);
-		else if(physicalMM2 == ref) movq(qword_ptr [physicalMM2], mm2);
-		else if(physicalMM3 == ref) movq(qword_ptr [physicalMM3], mm3);
-		else if(physicalMM4 == ref) movq(qword_ptr [physicalMM4], mm4);
-		else if(physicalMM5 == ref) movq(qword_ptr [physicalMM5], mm5);
-		else if(physicalMM6 == ref) movq(qword_ptr [physicalMM6], mm6);
-		else if(physicalMM7 == ref) movq(qword_ptr [physicalMM7], mm7);
+		for(int f = 0; f < 3; f++)
+		{
+			const int r = findRegister(f, ref);
 
-		free(ref);
+			if(r >= 0)
+			{
+				spillRegister(f, r);
+				statistics.explicitSpills++;
+			}
+		}
 	}
 
 	void CodeGenerator::freeAll()
 	{
-		free(eax);
-		free(ecx);
-		free(edx);
-		free(ebx);
-		free(esi);
-		free(edi);
-
-		free(mm0);
-		free(mm1);
-		free(mm2);
-		free(mm3);
-		free(mm4);
-		free(mm5);
-		free(mm6);
-		free(mm7);
-
-		free(xmm0);
-		free(xmm1);
-		free(xmm2);
-		free(xmm3);
-		free(xmm4);
-		free(xmm5);
-		free(xmm6);
-		free(xmm7);
+		if(recording)
+		{
+			releaseAll(false);
+			return;
+		}
+
+		for(int f = 0; f < 3; f++)
+		{
+			for(unsigned int mask = registerFile[f].available; mask; mask &= mask - 1)
+			{
+				freeRegister(f, lowestBit(mask));
+			}
+		}
 	}
 
 	void CodeGenerator::spillAll()
 	{
-		spill(eax);
-		spill(ecx);
-		spill(edx);
-		spill(ebx);
-		spill(esi);
-		spill(edi);
-
-		spill(mm0);
-		spill(mm1);
-		spill(mm2);
-		spill(mm3);
-		spill(mm4);
-		spill(mm5);
-		spill(mm6);
-		spill(mm7);
-
-		spill(xmm0);
-		spill(xmm1);
-		spill(xmm2);
-		spill(xmm3);
-		spill(xmm4);
-		spill(xmm5);
-		spill(xmm6);
-		spill(xmm7);
-	}
-}
+		if(recording)
+		{
+			releaseAll(true);
+			return;
+		}
+
+		for(int f = 0; f < 3; f++)
+		{
+			statistics.explicitSpills += bitCount(registerFile[f].allocated);
+
+			for(unsigned int mask = registerFile[f].available; mask; mask &= mask - 1)
+			{
+				spillRegister(f, lowestBit(mask));
+			}
+		}
+	}
+
+	int CodeGenerator::findRegister(int f, const OperandREF &ref) const
+	{
+		const RegisterFile &file = registerFile[f];
+
+		for(unsigned int mask = file.allocated; mask; mask &= mask - 1)
+		{
+			const int r = lowestBit(mask);
+
+			if(file.physical[r] == ref)
+			{
+				return r;
+			}
+		}
+
+		return -1;
+	}
+
+	int CodeGenerator::allocateRegister(int f, const OperandREF &ref, bool copy)
+	{
+		static const char *fileName[3] = {"general purpose", "MMX", "SSE"};
+
+		RegisterFile &file = registerFile[f];
+
+		// Check if already allocated
+		const int r = findRegister(f, ref);
+
+		if(r >= 0)
+		{
+			return accessRegister(f, r);
+		}
+
+		// Search for free registers
+		const unsigned int unused = file.available & ~file.allocated;
+
+		if(unused)
+		{
+			return assignRegister(f, lowestBit(unused), ref, copy);
+		}
+
+		// Need to spill one
+		int candidate = -1;
+		unsigned int priority = 0xFFFFFFFF;
+
+		for(unsigned int mask = file.allocated; mask; mask &= mask - 1)
+		{
+			const int c = lowestBit(mask);
+
+			if(file.priority[c] < priority && spillable(file.physical[c]))
+			{
+				priority = file.priority[c];
+				candidate = c;
+			}
+		}
+
+		if(candidate < 0) throw Error("Out of physical %s registers. Use free().", fileName[f]);
+
+		spillRegister(f, candidate);
+		statistics.evictions++;
+
+		return assignRegister(f, candidate, ref, copy);
+	}
+
+	int CodeGenerator::assignRegister(int f, int r, const OperandREF &ref, bool copy)
+	{
+		static const char *registerName[3][8] =
+		{
+			{"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"},
+			{"mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"},
+			{"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"}
+		};
+
+		RegisterFile &file = registerFile[f];
+
+		if(r < 0 || r >= file.count) throw INTERNAL_ERROR;
+
+		const int c = findRegister(f, ref);
+
+		if(c == r)
+		{
+			return accessRegister(f, r);
+		}
+
+		if(!(file.available & ~file.allocated & 1 << r))
+		{
+			throw Error("%s not available for register allocation", r < 8 ? registerName[f][r] : "Register");
+		}
+
+		file.allocated |= 1 << r;
+		file.physical[r] = ref;
+		file.priority[r] = 0xFFFFFFFF;
+
+		notePressure(f, bitCount(file.allocated));
+
+		if(c >= 0)   // Already in another register, move it over instead of going through memory
+		{
+			const unsigned int modified = copy && file.dirty & 1 << c;
+
+			if(copy)
+			{
+				switch(f)
+				{
+				case 0: mov(operand32(r), operand32(c)); break;
+				case 1: movq(operand64(r), operand64(c)); break;
+				case 2: movaps(operand128(r), operand128(c)); break;
+				}
+			}
+
+			file.allocated &= ~(1 << c);
+			file.physical[c] = 0;
+			file.priority[c] = 0;
+			file.dirty &= ~(1 << c | 1 << r);
+			file.dirty |= modified << r;
+
+			return accessRegister(f, r);
+		}
+
+		if(real(ref) ? copy : temporary(ref) && file.stacked & 1 << ref.displacement)
+		{
+			load(f, r, ref);
+		}
+
+		file.dirty &= ~(1 << r);
+
+		return accessRegister(f, r);
+	}
+
+	int CodeGenerator::accessRegister(int f, int r)
+	{
+		RegisterFile &file = registerFile[f];
+
+		// Decrease priority of other registers
+		for(unsigned int mask = file.allocated & ~(1 << r); mask; mask &= mask - 1)
+		{
+			const int c = lowestBit(mask);
+
+			if(file.priority[c]) file.priority[c]--;
+		}
+
+		return r;
+	}
+
+	void CodeGenerator::freeRegister(int f, int r)
+	{
+		RegisterFile &file = registerFile[f];
+
+		if(r < 0 || r >= file.count || !(file.available & 1 << r)) throw INTERNAL_ERROR;
+
+		if(file.allocated & 1 << r && temporary(file.physical[r]))
+		{
+			file.stacked &= ~(1 << file.physical[r].displacement);
+		}
+
+		file.allocated &= ~(1 << r);
+		file.physical[r] = 0;
+		file.priority[r] = 0;
+		file.dirty &= ~(1 << r);
+	}
+
+	void CodeGenerator::spillRegister(int f, int r)
+	{
+		RegisterFile &file = registerFile[f];
+
+		if(r < 0 || r >= file.count) throw INTERNAL_ERROR;
+
+		const OperandREF ref = file.physical[r];
+		const bool allocated = (file.allocated & 1 << r) != 0;
+
+		if(allocated && file.dirty & 1 << r && spillable(ref))
+		{
+			store(f, r, ref);
+		}
+
+		freeRegister(f, r);
+
+		if(allocated && framed && temporary(ref))
+		{
+			file.stacked |= 1 << ref.displacement;
+		}
+	}
+
+	const OperandREG32 &CodeGenerator::operand32(int r)
+	{
+		static const OperandREG32 *const reg[8] = {&eax, &ecx, &edx, &ebx, &esp, &ebp, &esi, &edi};
+
+		if(r < 0 || r >= 8) throw INTERNAL_ERROR;
+
+		return *reg[r];
+	}
+
+	const OperandMMREG &CodeGenerator::operand64(int r)
+	{
+		static const OperandMMREG *const reg[8] = {&mm0, &mm1, &mm2, &mm3, &mm4, &mm5, &mm6, &mm7};
+
+		if(r < 0 || r >= 8) throw INTERNAL_ERROR;
+
+		return *reg[r];
+	}
+
+	const OperandXMMREG &CodeGenerator::operand128(int r)
+	{
+		static const OperandXMMREG *const reg[8] = {&xmm0, &xmm1, &xmm2, &xmm3, &xmm4, &xmm5, &xmm6, &xmm7};
+
+		if(r < 0 || r >= 8) throw INTERNAL_ERROR;
+
+		return *reg[r];
+	}
+
+	int CodeGenerator::bitCount(unsigned int mask)
+	{
+		int n = 0;
+
+		for(; mask; mask &= mask - 1)
+		{
+			n++;
+		}
+
+		return n;
+	}
+
+	void CodeGenerator::notePressure(int file, int count)
+	{
+		if(count > statistics.peakRegisters[file])
+		{
+			statistics.peakRegisters[file] = count;
+		}
+	}
+
+	void CodeGenerator::beginRecording()
+	{
+		if(recording) throw Error("Already recording");
+
+		spillAll();
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].stacked = 0;   // Temporaries don't carry over
+		}
+
+		recording = true;
+		virtuals = new VirtualList();
+		virtualTail = virtuals;
+		recorded = new RecordedList();
+		numVirtuals = 0;
+		numRecorded = 0;
+	}
+
+	void CodeGenerator::endRecording()
+	{
+		if(!recording) throw Error("Not recording");
+
+		recording = false;
+
+		try
+		{
+			linearScan();
+		}
+		catch(...)
+		{
+			discardRecording();
+			throw;
+		}
+
+		discardRecording();
+	}
+
+	void CodeGenerator::label(const char *label)
+	{
+		if(recording)
+		{
+			Recorded entry;
+
+			entry.instructionID = LABEL;
+
+			for(int i = 0; i < 3; i++)
+			{
+				entry.operand[i].type = Operand::VOID;
+				entry.reference[i] = 0;
+			}
+
+			entry.label = strdup(label);
+			entry.depth = 0;
+
+			recorded->append(entry);
+			numRecorded++;
+		}
+		else
+		{
+			invalidateLoads();   // Other paths join here
+
+			if(mmxUsed)
+			{
+				mmxState = true;
+			}
+
+			Defined entry;
+
+			entry.label = strdup(label);
+			entry.open = !mmxState;
+			entry.empty = false;
+
+			defined->append(entry);
+			openLabels |= entry.open;
+
+			Assembler::label(label);
+		}
+	}
+
+	void CodeGenerator::invalidateLoads()
+	{
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].cached = 0;
+		}
+	}
+
+	void CodeGenerator::automaticEmms(bool enable)
+	{
+		autoEmms = enable;
+	}
+
+	void CodeGenerator::warnMMX(bool warn)
+	{
+		mmxWarnings = warn;
+	}
+
+	const CodeGenerator::Statistics &CodeGenerator::getStatistics() const
+	{
+		return statistics;
+	}
+
+	void CodeGenerator::resetStatistics()
+	{
+		for(int f = 0; f < 3; f++)
+		{
+			statistics.peakRegisters[f] = 0;
+		}
+
+		statistics.spills = 0;
+		statistics.reloads = 0;
+		statistics.evictions = 0;
+		statistics.explicitSpills = 0;
+		statistics.reusedLoads = 0;
+	}
+
+	void CodeGenerator::annotateStatistics()
+	{
+		annotate("Registers at peak: %d of %d general purpose, %d of %d MMX, %d of %d SSE",
+		         statistics.peakRegisters[0], bitCount(registerFile[0].available),
+		         statistics.peakRegisters[1], bitCount(registerFile[1].available),
+		         statistics.peakRegisters[2], bitCount(registerFile[2].available));
+		annotate("Spills: %d, reloads: %d, evictions: %d, explicit spills: %d, reused loads: %d",
+		         statistics.spills, statistics.reloads, statistics.evictions, statistics.explicitSpills, statistics.reusedLoads);
+	}
+
+	CodeGenerator::Virtual *CodeGenerator::findVirtual(const OperandREF &ref, int file)
+	{
+		for(VirtualList *v = virtuals; v && v->next(); v = v->next())
+		{
+			if(v->live && v->file == file && v->ref == ref)
+			{
+				return v;
+			}
+		}
+
+		return 0;
+	}
+
+	CodeGenerator::Virtual &CodeGenerator::virtualRegister(const OperandREF &ref, int file, bool copy)
+	{
+		Virtual *existing = findVirtual(ref, file);
+
+		if(existing)
+		{
+			return *existing;
+		}
+
+		Encoding::Reg reg = (Encoding::Reg)(VIRTUAL + numVirtuals++);
+
+		Virtual v;
+
+		v.reg32 = OperandREG32(reg);
+		v.reg64 = OperandMMREG(reg);
+		v.reg128 = OperandXMMREG(reg);
+		v.ref = ref;
+		v.file = file;
+		v.copy = copy;
+		v.live = true;
+		v.store = true;
+		v.first = -1;
+		v.last = -1;
+		v.cost = 0;
+		v.physical = -1;
+		v.stackable = false;
+		v.coalesced = false;
+		v.handover = false;
+
+		VirtualList *node = virtualTail;
+		virtualTail = virtuals->append(v);
+
+		return *node;
+	}
+
+	void CodeGenerator::release(Virtual &v, bool store)
+	{
+		if(store)   // Stays allocated, memory is updated at this point
+		{
+			Recorded entry;
+
+			entry.instructionID = WRITE_BACK;
+
+			switch(v.file)
+			{
+			case 0: entry.operand[0] = v.reg32; break;
+			case 1: entry.operand[0] = v.reg64; break;
+			case 2: entry.operand[0] = v.reg128; break;
+			default: throw INTERNAL_ERROR;
+			}
+
+			for(int i = 0; i < 3; i++)
+			{
+				if(i > 0) entry.operand[i].type = Operand::VOID;
+				entry.reference[i] = 0;
+			}
+
+			entry.label = 0;
+			entry.depth = 0;
+
+			recorded->append(entry);
+			numRecorded++;
+		}
+		else
+		{
+			v.live = false;
+			v.store = false;
+		}
+	}
+
+	void CodeGenerator::release(const OperandREF &ref, bool store)
+	{
+		for(VirtualList *v = virtuals; v && v->next(); v = v->next())
+		{
+			if(v->live && v->ref == ref)
+			{
+				release(*v, store);
+			}
+		}
+	}
+
+	void CodeGenerator::release(int id, bool store)
+	{
+		int i = 0;
+
+		for(VirtualList *v = virtuals; v && v->next(); v = v->next(), i++)
+		{
+			if(i == id && v->live)
+			{
+				release(*v, store);
+			}
+		}
+	}
+
+	void CodeGenerator::releaseAll(bool store)
+	{
+		for(VirtualList *v = virtuals; v && v->next(); v = v->next())
+		{
+			if(v->live)
+			{
+				release(*v, store);
+			}
+		}
+	}
+
+	void CodeGenerator::linearScan()
+	{
+		static const char *fileName[3] = {"general purpose", "MMX", "SSE"};
+
+		const int n = numRecorded;
+
+		Recorded **entry = new Recorded*[n + 1];
+		Virtual **table = new Virtual*[numVirtuals + 1];
+		Virtual **order = new Virtual*[numVirtuals + 1];
+		int *target = new int[n + 1];
+		const int words = (numVirtuals + 31) / 32;
+		unsigned int *liveIn = new unsigned int[(n + 1) * words + 1];
+		unsigned int *liveOut = new unsigned int[(n + 1) * words + 1];
+		unsigned int *read = new unsigned int[(n + 1) * words + 1];
+		unsigned int (*fixed)[3] = new unsigned int[n + 1][3];   // Physical registers used explicitly, or holding a value read later
+		int previous[3][MAX_REGISTERS];   // Last explicit use of each physical register
+
+		int k = 0;
+
+		for(RecordedList *r = recorded; r && r->next(); r = r->next())
+		{
+			entry[k++] = r;
+		}
+
+		k = 0;
+
+		for(VirtualList *v = virtuals; v && v->next(); v = v->next())
+		{
+			table[k++] = v;
+		}
+
+		memset(fixed, 0, (n + 1) * sizeof(fixed[0]));
+
+		for(int f = 0; f < 3; f++)
+		{
+			for(int r = 0; r < MAX_REGISTERS; r++)
+			{
+				previous[f][r] = 0;   // Values read before being written come from before the routine
+			}
+		}
+
+		try
+		{
+			// Jumps to recorded labels, backward ones form loops
+			for(int p = 0; p < n; p++)
+			{
+				target[p] = -1;
+
+				if(entry[p]->instructionID < 0 || !entry[p]->reference[0])
+				{
+					continue;
+				}
+
+				if(semantics(entry[p]->instructionID) & InstructionSet::BRANCH)
+				{
+					for(int q = 0; q < n; q++)
+					{
+						if(entry[q]->instructionID == LABEL && strcmp(entry[q]->label, entry[p]->reference[0]) == 0)
+						{
+							target[p] = q;
+							break;
+						}
+					}
+				}
+			}
+
+			liveness(entry, n, table, target, liveIn, liveOut, read);
+
+			for(int p = 0; p < n; p++)
+			{
+				if(target[p] >= 0 && target[p] <= p)
+				{
+					for(int q = target[p]; q <= p; q++)
+					{
+						entry[q]->depth++;
+					}
+				}
+			}
+
+			// Live ranges and spill costs
+			for(int p = 0; p < n; p++)
+			{
+				const Recorded &e = *entry[p];
+
+				if(e.instructionID == LABEL)
+				{
+					continue;
+				}
+
+				const unsigned int weight = 1 << 3 * (e.depth < 8 ? e.depth : 8);
+				const int overwritten = writeOnly(e);
+
+				for(int i = 0; i < 3; i++)
+				{
+					const Operand &operand = e.operand[i];
+					Encoding::Reg reg[2] = {Encoding::REG_UNKNOWN, Encoding::REG_UNKNOWN};
+					int f = 0;
+					bool reads = true;
+
+					if(Operand::isVoid(operand))
+					{
+						continue;
+					}
+					else if(Operand::isReg(operand))
+					{
+						     if(operand.isSubtypeOf(Operand::REG8))   {f = 0; reg[0] = virtualIndex(operand.reg) < 0 ? (Encoding::Reg)(operand.reg & 3) : operand.reg;}
+						else if(operand.isSubtypeOf(Operand::REG16))  {f = 0; reg[0] = operand.reg;}
+						else if(operand.isSubtypeOf(Operand::REG32))  {f = 0; reg[0] = operand.reg; reads = i >= overwritten;}
+						else if(operand.isSubtypeOf(Operand::MMREG))  {f = 1; reg[0] = operand.reg; reads = i >= overwritten;}
+						else if(operand.isSubtypeOf(Operand::XMMREG)) {f = 2; reg[0] = operand.reg; reads = i >= overwritten;}
+					}
+					else if(Operand::isMem(operand))
+					{
+						reg[0] = operand.baseReg;
+						reg[1] = operand.indexReg;
+					}
+
+					for(int j = 0; j < 2; j++)
+					{
+						const int id = virtualIndex(reg[j]);
+
+						if(id >= 0)
+						{
+							Virtual &v = *table[id];
+
+							if(v.first < 0) v.first = p;
+							v.last = p;
+							v.cost += weight;
+						}
+						else if(reg[j] >= 0 && reg[j] < registerFile[f].count)
+						{
+							fixRegister(fixed, previous[f], f, reg[j], p, reads);
+						}
+					}
+				}
+
+				if(e.instructionID == WRITE_BACK)
+				{
+					continue;
+				}
+
+				const unsigned int implicit = implicitRegisters(e.instructionID, e.operand[0], e.operand[1]);
+				unsigned int clobbered[3] = {0, 0, 0};
+
+				if(semantics(e.instructionID) & InstructionSet::CALL)
+				{
+					clobbered[0] = 1 << Encoding::EAX | 1 << Encoding::ECX | 1 << Encoding::EDX;
+					clobbered[1] = 0xFF;
+					clobbered[2] = 0xFF;
+				}
+
+				for(int f = 0; f < 3; f++)
+				{
+					for(int r = 0; r < registerFile[f].count; r++)
+					{
+						if(f == 0 && implicit & 1 << r)
+						{
+							fixRegister(fixed, previous[f], f, r, p, true);
+						}
+						else if(clobbered[f] & 1 << r)
+						{
+							fixRegister(fixed, previous[f], f, r, p, false);
+						}
+					}
+				}
+			}
+
+			// Values live across a jump stay in their register until both paths meet
+			for(bool changed = true; changed;)
+			{
+				changed = false;
+
+				for(int p = 0; p < n; p++)
+				{
+					if(target[p] < 0)
+					{
+						continue;
+					}
+
+					int lo = target[p] < p ? target[p] : p;
+					int hi = target[p] < p ? p : target[p];
+
+					for(int i = 0; i < numVirtuals; i++)
+					{
+						Virtual &v = *table[i];
+
+						changed |= cover(v.first, v.last, lo, hi);
+
+						// Carried around a loop, load before it and store after it
+						if(target[p] <= p && v.first >= 0 && v.first <= hi && lo <= v.last && (lo < v.first || v.last < hi) && member(liveIn, words, lo, i))
+						{
+							if(lo < v.first) v.first = lo;
+							if(v.last < hi) v.last = hi;
+							changed = true;
+						}
+					}
+
+					for(int f = 0; f < 3; f++)
+					{
+						for(int r = 0; r < registerFile[f].count; r++)
+						{
+							changed |= coverFixed(fixed, n, f, r, lo, hi);
+						}
+					}
+				}
+			}
+
+			// Temporaries can be kept in their stack slot when no other range shares it
+			for(int i = 0; i < numVirtuals; i++)
+			{
+				Virtual &v = *table[i];
+
+				v.stackable = framed && v.first >= 0 && temporary(v.ref);
+
+				for(int j = 0; j < numVirtuals && v.stackable; j++)
+				{
+					const Virtual &w = *table[j];
+
+					if(j != i && w.first >= 0 && w.file == v.file && w.ref == v.ref && w.first <= v.last && v.first <= w.last)
+					{
+						v.stackable = false;
+					}
+				}
+			}
+
+			// Linear scan in order of range start
+			int m = 0;
+
+			for(int i = 0; i < numVirtuals; i++)
+			{
+				if(table[i]->first < 0)
+				{
+					continue;
+				}
+
+				int j = m++;
+
+				for(; j > 0 && order[j - 1]->first > table[i]->first; j--)
+				{
+					order[j] = order[j - 1];
+				}
+
+				order[j] = table[i];
+			}
+
+			Virtual *holder[3][MAX_REGISTERS] = {0};
+
+			for(int i = 0; i < m; i++)
+			{
+				Virtual &v = *order[i];
+				const int f = v.file;
+				int physical = -1;
+
+				// Ranges joined by a copy share the register, so the move disappears
+				if(entry[v.first]->instructionID >= 0)
+				{
+					const Recorded &e = *entry[v.first];
+					const Encoding::Reg source = e.operand[1].reg;
+
+					if(copyFile(e.instructionID, e.operand[0], e.operand[1]) == f && e.operand[0].reg == v.reg32.reg)
+					{
+						if(virtualIndex(source) >= 0)
+						{
+							Virtual &w = *table[virtualIndex(source)];
+							const int r = w.physical;
+
+							if(r >= 0 && w.last == v.first && holder[f][r] == &w && !fixedWithin(fixed, f, r, v.first, v.last))
+							{
+								physical = r;
+								v.coalesced = true;
+								w.handover = true;
+							}
+						}
+						else if(source < registerFile[f].count && registerFile[f].available & 1 << source && fixed[v.first][f] & 1 << source && !fixedWithin(fixed, f, source, v.first + 1, v.last) && (!holder[f][source] || holder[f][source]->last < v.first))
+						{
+							physical = source;
+						}
+					}
+				}
+
+				if(physical < 0 && entry[v.last]->instructionID >= 0)
+				{
+					const Recorded &e = *entry[v.last];
+					const Encoding::Reg destination = e.operand[0].reg;
+
+					if(copyFile(e.instructionID, e.operand[0], e.operand[1]) == f && e.operand[1].reg == v.reg32.reg)
+					{
+						if(destination < registerFile[f].count && registerFile[f].available & 1 << destination && !fixedWithin(fixed, f, destination, v.first, v.last - 1) && (!holder[f][destination] || holder[f][destination]->last < v.first))
+						{
+							physical = destination;
+						}
+					}
+				}
+
+				for(unsigned int mask = registerFile[f].available; mask && physical < 0; mask &= mask - 1)
+				{
+					const int r = lowestBit(mask);
+					const bool blocked = fixedWithin(fixed, f, r, v.first, v.last);
+
+					if(!blocked && (!holder[f][r] || holder[f][r]->last < v.first))
+					{
+						physical = r;
+					}
+				}
+
+				if(physical < 0)
+				{
+					// Keep the range with the lowest weighted use count in memory
+					Virtual *victim = real(v.ref) || v.stackable ? &v : 0;
+					unsigned int cost = victim ? v.cost : 0xFFFFFFFF;
+
+					for(unsigned int mask = registerFile[f].available; mask; mask &= mask - 1)
+					{
+						const int r = lowestBit(mask);
+						const bool blocked = fixedWithin(fixed, f, r, v.first, v.last);
+						Virtual *active = holder[f][r];
+
+						if(!blocked && active && active->last >= v.first && !(active->coalesced && active->first == v.first) && (real(active->ref) || active->stackable) && (!victim || active->cost < cost))
+						{
+							victim = active;
+							cost = active->cost;
+						}
+					}
+
+					if(!victim)
+					{
+						throw Error("Out of physical %s registers", fileName[f]);
+					}
+
+					statistics.evictions++;
+
+					if(victim == &v)
+					{
+						continue;
+					}
+
+					physical = victim->physical;
+					victim->physical = -1;
+				}
+
+				v.physical = physical;
+				holder[f][physical] = &v;
+			}
+
+			emitRecorded(entry, n, table, target, fixed, liveIn, liveOut, read);
+		}
+		catch(...)
+		{
+			delete[] entry;
+			delete[] table;
+			delete[] order;
+			delete[] target;
+			delete[] liveIn;
+			delete[] liveOut;
+			delete[] read;
+			delete[] fixed;
+
+			throw;
+		}
+
+		delete[] entry;
+		delete[] table;
+		delete[] order;
+		delete[] target;
+		delete[] liveIn;
+		delete[] liveOut;
+		delete[] read;
+		delete[] fixed;
+	}
+
+	void CodeGenerator::liveness(Recorded **entry, int n, Virtual **table, const int *target, unsigned int *liveIn, unsigned int *liveOut, unsigned int *read)
+	{
+		const int words = (numVirtuals + 31) / 32;
+		unsigned int *kill = new unsigned int[(n + 1) * words + 1];   // Overwritten without being read
+
+		memset(liveIn, 0, ((n + 1) * words + 1) * sizeof(unsigned int));
+		memset(liveOut, 0, ((n + 1) * words + 1) * sizeof(unsigned int));
+		memset(read, 0, ((n + 1) * words + 1) * sizeof(unsigned int));
+		memset(kill, 0, ((n + 1) * words + 1) * sizeof(unsigned int));
+
+		// Memory variables are observed after the routine, temporaries and freed variables are not
+		for(int i = 0; i < numVirtuals; i++)
+		{
+			if(table[i]->store && real(table[i]->ref))
+			{
+				liveIn[n * words + i / 32] |= 1 << i % 32;
+			}
+		}
+
+		for(int p = 0; p < n; p++)
+		{
+			const Recorded &e = *entry[p];
+			const int overwritten = writeOnly(e);
+
+			for(int j = 0; j < 3; j++)
+			{
+				const Operand &operand = e.operand[j];
+
+				if(e.instructionID == LABEL || Operand::isVoid(operand))
+				{
+					continue;
+				}
+				else if(Operand::isReg(operand) && virtualIndex(operand.reg) >= 0)
+				{
+					const int id = virtualIndex(operand.reg);
+					unsigned int *set = j < overwritten ? kill : read;
+
+					set[p * words + id / 32] |= 1 << id % 32;
+				}
+				else if(Operand::isMem(operand))
+				{
+					const int base = virtualIndex(operand.baseReg);
+					const int index = virtualIndex(operand.indexReg);
+
+					if(base >= 0) read[p * words + base / 32] |= 1 << base % 32;
+					if(index >= 0) read[p * words + index / 32] |= 1 << index % 32;
+				}
+			}
+		}
+
+		// Backward dataflow over fall-through and jump edges
+		bool changed = true;
+
+		while(changed)
+		{
+			changed = false;
+
+			for(int p = n - 1; p >= 0; p--)
+			{
+				const int flags = semantics(entry[p]->instructionID);
+				bool fallThrough = true;
+				int branch = -1;
+
+				if(flags & InstructionSet::BRANCH)
+				{
+					branch = target[p] >= 0 ? target[p] : n;   // Leaving the routine
+					fallThrough = !(flags & InstructionSet::JUMP);
+				}
+				else if(flags & InstructionSet::RETURN)
+				{
+					branch = n;
+					fallThrough = false;
+				}
+
+				for(int w = 0; w < words; w++)
+				{
+					unsigned int out = 0;
+
+					if(fallThrough) out |= liveIn[(p + 1) * words + w];
+					if(branch >= 0) out |= liveIn[branch * words + w];
+
+					const unsigned int in = read[p * words + w] | (out & ~kill[p * words + w]);
+
+					if(in != liveIn[p * words + w] || out != liveOut[p * words + w])
+					{
+						liveIn[p * words + w] = in;
+						liveOut[p * words + w] = out;
+						changed = true;
+					}
+				}
+			}
+		}
+
+		delete[] kill;
+	}
+
+	void CodeGenerator::emitRecorded(Recorded **entry, int n, Virtual **table, const int *target, const unsigned int (*fixed)[3], const unsigned int *liveIn, const unsigned int *liveOut, const unsigned int *read)
+	{
+		static const char *fileName[3] = {"general purpose", "MMX", "SSE"};
+
+		const int words = (numVirtuals + 31) / 32;
+
+		unsigned int (*pending)[3] = new unsigned int[n + 1][3];   // Dirty registers at forward jumps to each entry
+		memset(pending, 0, (n + 1) * sizeof(pending[0]));
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].dirty = 0;
+		}
+
+		try
+		{
+			for(int p = 0; p <= n; p++)
+			{
+				// Write back ranges that ended, then load ranges that start here
+				for(int i = 0; i < numVirtuals; i++)
+				{
+					const Virtual &v = *table[i];
+
+					if(v.first >= 0 && v.physical >= 0 && v.last == (v.handover ? p : p - 1) && v.store && real(v.ref) && dirty(v.file) & 1 << v.physical)
+					{
+						store(v.file, v.physical, v.ref);
+					}
+				}
+
+				for(int i = 0; i < numVirtuals; i++)
+				{
+					const Virtual &v = *table[i];
+
+					if(v.first == p && v.physical >= 0)
+					{
+						if(v.copy && real(v.ref) && member(liveIn, words, p, i))   // Skip values overwritten before being read
+						{
+							load(v.file, v.physical, v.ref);
+						}
+
+						dirty(v.file) &= ~(1 << v.physical);
+					}
+				}
+
+				if(p == n)
+				{
+					break;
+				}
+
+				const Recorded &e = *entry[p];
+
+				if(e.instructionID == WRITE_BACK)
+				{
+					const Virtual &v = *table[virtualIndex(e.operand[0].reg)];
+
+					if(v.physical >= 0 && real(v.ref) && dirty(v.file) & 1 << v.physical)
+					{
+						store(v.file, v.physical, v.ref);
+					}
+
+					if(v.physical >= 0)
+					{
+						statistics.explicitSpills++;
+					}
+
+					continue;
+				}
+				else if(e.instructionID == LABEL)
+				{
+					// Registers written anywhere in a loop are dirty at its start
+					int end = -1;
+
+					for(int q = p; q < n; q++)
+					{
+						if(target[q] == p) end = q;
+					}
+
+					for(int i = 0; i < numVirtuals && end >= 0; i++)
+					{
+						const Virtual &v = *table[i];
+
+						if(v.first < 0 || v.physical < 0 || v.first > p || v.last < p)
+						{
+							continue;
+						}
+
+						for(int q = p; q <= end; q++)
+						{
+							if(entry[q]->instructionID < 0)
+							{
+								continue;
+							}
+
+							for(int j = 0; j < 3; j++)
+							{
+								const Operand &operand = entry[q]->operand[j];
+
+								if(Operand::isReg(operand) && !Operand::isVoid(operand) && virtualIndex(operand.reg) == i && writesOperand(entry[q]->instructionID, j))
+								{
+									dirty(v.file) |= 1 << v.physical;
+								}
+							}
+						}
+					}
+
+					registerFile[0].dirty |= pending[p][0];
+					registerFile[1].dirty |= pending[p][1];
+					registerFile[2].dirty |= pending[p][2];
+
+					label(e.label);
+
+					continue;
+				}
+
+				// Values kept in memory get a scratch register for this instruction
+				Operand operand[3] = {e.operand[0], e.operand[1], e.operand[2]};
+				Virtual *spilled[4];
+				Virtual *borrowed[4];
+				int scratch[4];
+				int numSpilled = 0;
+
+				for(int i = 0; i < 3; i++)
+				{
+					Encoding::Reg *field[2] = {0, 0};
+
+					if(Operand::isVoid(operand[i]))
+					{
+						continue;
+					}
+					else if(Operand::isReg(operand[i]))
+					{
+						field[0] = &operand[i].reg;
+					}
+					else if(Operand::isMem(operand[i]))
+					{
+						field[0] = &operand[i].baseReg;
+						field[1] = &operand[i].indexReg;
+					}
+
+					for(int j = 0; j < 2; j++)
+					{
+						if(!field[j] || virtualIndex(*field[j]) < 0)
+						{
+							continue;
+						}
+
+						Virtual &v = *table[virtualIndex(*field[j])];
+
+						if(v.physical >= 0)
+						{
+							*field[j] = (Encoding::Reg)v.physical;
+							continue;
+						}
+
+						int s = 0;
+
+						while(s < numSpilled && spilled[s] != &v) s++;
+
+						if(s == numSpilled)
+						{
+							const int f = v.file;
+							int r = -1;
+							Virtual *owner = 0;
+
+							for(unsigned int mask = registerFile[f].available; mask; mask &= mask - 1)
+							{
+								const int c = lowestBit(mask);
+								bool taken = (fixed[p][f] & 1 << c) != 0;
+
+								for(int t = 0; t < numSpilled; t++)
+								{
+									taken |= spilled[t]->file == f && scratch[t] == c;
+								}
+
+								Virtual *active = 0;
+
+								for(int w = 0; w < numVirtuals; w++)
+								{
+									if(table[w]->file == f && table[w]->physical == c && table[w]->first <= p && p <= table[w]->last)
+									{
+										active = table[w];
+									}
+								}
+
+								if(taken)
+								{
+									continue;
+								}
+								else if(!active)
+								{
+									r = c;
+									owner = 0;
+									break;
+								}
+								else if(r < 0 && (real(active->ref) || active->stackable) && !uses(e, virtualIndex(active->reg32.reg)))
+								{
+									r = c;
+									owner = active;
+								}
+							}
+
+							if(r < 0)
+							{
+								throw Error("Out of physical %s registers", fileName[f]);
+							}
+
+							spilled[s] = &v;
+							borrowed[s] = owner;
+							scratch[s] = r;
+							numSpilled++;
+
+							if(owner)
+							{
+								statistics.evictions++;
+							}
+
+							if(owner && dirty(f) & 1 << r && member(liveOut, words, p, virtualIndex(owner->reg32.reg)))
+							{
+								store(f, r, owner->ref);
+							}
+
+							if((v.copy || p != v.first) && member(read, words, p, virtualIndex(v.reg32.reg)))
+							{
+								load(f, r, v.ref);
+							}
+
+							dirty(f) &= ~(1 << r);
+						}
+
+						*field[j] = (Encoding::Reg)scratch[s];
+					}
+				}
+
+				const int copied = copyFile(e.instructionID, operand[0], operand[1]);
+				const unsigned int modified = copied >= 0 ? dirty(copied) : 0;
+
+				x86(e.instructionID, operand[0], operand[1], operand[2]);
+
+				if(copied >= 0 && operand[0].reg == operand[1].reg && virtualIndex(e.operand[0].reg) < 0)
+				{
+					dirty(copied) = modified;   // Copy into the register the value already lives in
+				}
+
+				int inUse[3] = {0, 0, 0};
+
+				for(int i = 0; i < numVirtuals; i++)
+				{
+					const Virtual &v = *table[i];
+
+					if(v.first >= 0 && v.physical >= 0 && v.first <= p && p <= v.last && !(v.handover && v.last == p))
+					{
+						inUse[v.file]++;
+					}
+				}
+
+				for(int s = 0; s < numSpilled; s++)
+				{
+					if(!borrowed[s]) inUse[spilled[s]->file]++;
+				}
+
+				for(int f = 0; f < 3; f++)
+				{
+					notePressure(f, inUse[f]);
+				}
+
+				for(int s = 0; s < numSpilled; s++)
+				{
+					const int f = spilled[s]->file;
+
+					if(dirty(f) & 1 << scratch[s] && member(liveOut, words, p, virtualIndex(spilled[s]->reg32.reg)))
+					{
+						store(f, scratch[s], spilled[s]->ref);
+					}
+
+					if(borrowed[s] && member(liveOut, words, p, virtualIndex(borrowed[s]->reg32.reg)))
+					{
+						load(f, scratch[s], borrowed[s]->ref);
+					}
+
+					dirty(f) &= ~(1 << scratch[s]);
+				}
+
+				if(target[p] > p)
+				{
+					for(int i = 0; i < numVirtuals; i++)
+					{
+						const Virtual &v = *table[i];
+
+						if(v.first >= 0 && v.physical >= 0 && v.first <= p && v.last >= target[p])
+						{
+							pending[target[p]][v.file] |= dirty(v.file) & 1 << v.physical;
+						}
+					}
+				}
+			}
+		}
+		catch(...)
+		{
+			delete[] pending;
+			throw;
+		}
+
+		delete[] pending;
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].dirty = 0;
+		}
+	}
+
+	void CodeGenerator::discardRecording()
+	{
+		for(RecordedList *r = recorded; r && r->next(); r = r->next())
+		{
+			delete[] r->label;
+
+			for(int i = 0; i < 3; i++)
+			{
+				delete[] r->reference[i];
+			}
+		}
+
+		delete virtuals;
+		delete recorded;
+
+		recording = false;
+		virtuals = 0;
+		virtualTail = 0;
+		recorded = 0;
+		numVirtuals = 0;
+		numRecorded = 0;
+	}
+
+	void CodeGenerator::load(int file, int physical, const OperandREF &ref)
+	{
+		const Encoding *previous = lastEncoding();
+
+		switch(file)
+		{
+		case 0: mov(OperandREG32((Encoding::Reg)physical), dword_ptr [address(file, ref)]); break;
+		case 1: movq(OperandMMREG((Encoding::Reg)physical), qword_ptr [address(file, ref)]); break;
+		case 2:
+			if(real(ref)) movaps(OperandXMMREG((Encoding::Reg)physical), xword_ptr [address(file, ref)]);
+			else movups(OperandXMMREG((Encoding::Reg)physical), xword_ptr [address(file, ref)]);   // Slots are only 4-byte aligned through ebp
+			break;
+		default: throw INTERNAL_ERROR;
+		}
+
+		if(lastEncoding() != previous)   // Left out when the register still holds the value
+		{
+			statistics.reloads++;
+		}
+
+		dirty(file) &= ~(1 << physical);
+	}
+
+	void CodeGenerator::store(int file, int physical, const OperandREF &ref)
+	{
+		switch(file)
+		{
+		case 0: mov(dword_ptr [address(file, ref)], OperandREG32((Encoding::Reg)physical)); break;
+		case 1: movq(qword_ptr [address(file, ref)], OperandMMREG((Encoding::Reg)physical)); break;
+		case 2:
+			if(real(ref)) movaps(xword_ptr [address(file, ref)], OperandXMMREG((Encoding::Reg)physical));
+			else movups(xword_ptr [address(file, ref)], OperandXMMREG((Encoding::Reg)physical));
+			break;
+		default: throw INTERNAL_ERROR;
+		}
+
+		statistics.spills++;
+
+		dirty(file) &= ~(1 << physical);
+	}
+
+	unsigned int &CodeGenerator::dirty(int file)
+	{
+		if(file < 0 || file >= 3) throw INTERNAL_ERROR;
+
+		return registerFile[file].dirty;
+	}
+
+	bool CodeGenerator::cover(int &first, int &last, int lo, int hi)
+	{
+		if(first < 0)
+		{
+			return false;
+		}
+
+		if(first < lo && lo <= last && last < hi)
+		{
+			last = hi;
+			return true;
+		}
+
+		if(lo < first && first <= hi && hi < last)
+		{
+			first = lo;
+			return true;
+		}
+
+		return false;
+	}
+
+	void CodeGenerator::fixRegister(unsigned int (*fixed)[3], int *previous, int file, int physical, int p, bool read)
+	{
+		// A read keeps the register taken since its previous use
+		for(int q = read ? previous[physical] : p; q <= p; q++)
+		{
+			fixed[q][file] |= 1 << physical;
+		}
+
+		previous[physical] = p;
+	}
+
+	bool CodeGenerator::coverFixed(unsigned int (*fixed)[3], int n, int file, int physical, int lo, int hi)
+	{
+		const unsigned int bit = 1 << physical;
+
+		// Same as cover(), for the stretch of uses crossing into the jumped over entries
+		int first = lo;
+		int last = hi;
+
+		if(lo > 0 && fixed[lo - 1][file] & bit && fixed[lo][file] & bit)
+		{
+			for(last = lo; last < hi && fixed[last + 1][file] & bit;) last++;
+		}
+		else if(hi < n && fixed[hi][file] & bit && fixed[hi + 1][file] & bit)
+		{
+			for(first = hi; first > lo && fixed[first - 1][file] & bit;) first--;
+		}
+
+		if(first == lo && last == hi)
+		{
+			return false;
+		}
+
+		for(int q = lo; q <= hi; q++)
+		{
+			fixed[q][file] |= bit;
+		}
+
+		return true;
+	}
+
+	bool CodeGenerator::fixedWithin(const unsigned int (*fixed)[3], int file, int physical, int first, int last)
+	{
+		for(int p = first; p <= last; p++)
+		{
+			if(fixed[p][file] & 1 << physical)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool CodeGenerator::uses(const Recorded &entry, int id)
+	{
+		for(int i = 0; i < 3; i++)
+		{
+			const Operand &operand = entry.operand[i];
+
+			if(Operand::isVoid(operand))
+			{
+				continue;
+			}
+			else if(Operand::isReg(operand) && virtualIndex(operand.reg) == id)
+			{
+				return true;
+			}
+			else if(Operand::isMem(operand) && (virtualIndex(operand.baseReg) == id || virtualIndex(operand.indexReg) == id))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	int CodeGenerator::x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand, const Operand &thirdOperand)
+	{
+		if(recording)
+		{
+			Recorded entry;
+
+			entry.instructionID = instructionID;
+			entry.operand[0] = firstOperand;
+			entry.operand[1] = secondOperand;
+			entry.operand[2] = thirdOperand;
+
+			for(int i = 0; i < 3; i++)
+			{
+				entry.reference[i] = 0;
+
+				if(entry.operand[i].reference)
+				{
+					entry.reference[i] = strdup(entry.operand[i].reference);
+					entry.operand[i].reference = entry.reference[i];
+				}
+			}
+
+			entry.label = 0;
+			entry.depth = 0;
+
+			recorded->append(entry);
+			numRecorded++;
+
+			return instructionID;
+		}
+
+		const Instruction *instruction = Assembler::instruction(instructionID);
+
+		if(!instruction)
+		{
+			return Assembler::x86(instructionID, firstOperand, secondOperand, thirdOperand);
+		}
+
+		const Operand original[3] = {firstOperand, secondOperand, thirdOperand};
+		Operand operand[3] = {firstOperand, secondOperand, thirdOperand};
+
+		if(autoEmms && mmxState && (needsEmptyMMX(instructionID) || jumpsToEmpty(instructionID, firstOperand)))
+		{
+			emms();
+		}
+
+		if(openLabels && needsEmptyMMX(instructionID))
+		{
+			for(DefinedList *d = defined; d && d->next(); d = d->next())
+			{
+				d->empty |= d->open;
+			}
+		}
+
+		if(emptiesMMX(instructionID))
+		{
+			mmxState = false;
+		}
+		else if(usesMMX(operand))
+		{
+			mmxState = true;
+			mmxUsed = true;
+
+			for(DefinedList *d = defined; openLabels && d && d->next(); d = d->next())
+			{
+				d->open = false;
+			}
+
+			openLabels = false;
+
+			if(mmxWarnings && CPUID::supports(CPUID::SSE2) && semantics(instructionID) & InstructionSet::SSE2_EQUIVALENT)
+			{
+				annotate("MMX instruction '%s' has an SSE2 equivalent", instruction->getMnemonic());
+			}
+		}
+
+		if(reuseLoads(instructionID, operand))
+		{
+			return instructionID;   // Register already holds the value
+		}
+
+		unsigned int written[3];
+		writtenRegisters(instructionID, operand[0], operand[1], written);
+
+		for(int f = 0; f < 3; f++)
+		{
+			registerFile[f].dirty |= written[f];
+		}
+
+		touched |= written[0];
+		called |= (semantics(instructionID) & InstructionSet::CALL) != 0;
+
+		if(copyFile(instructionID, operand[0], operand[1]) >= 0 && operand[0].reg == operand[1].reg)
+		{
+			return instructionID;   // Copy to itself, left by coalescing
+		}
+
+		const int result = Assembler::x86(instructionID, operand[0], operand[1], operand[2]);
+
+		updateLoads(instructionID, original, operand, written);
+
+		return result;
+	}
+
+	bool CodeGenerator::reuseLoads(int instructionID, Operand *operand)
+	{
+		static const Operand::Type registerType[3] = {Operand::REG32, Operand::MMREG, Operand::XMMREG};
+
+		int f = moveFile(instructionID, operand[0], operand[1]);
+
+		if(f != -1 && registerFile[f].cached >> operand[0].reg & 1 && sameAddress(registerFile[f].memory[operand[0].reg], operand[1]))
+		{
+			statistics.reusedLoads++;
+
+			return true;
+		}
+
+		if(semantics(instructionID) & InstructionSet::BIT_TEST)   // Bit offsets reach beyond a memory operand
+		{
+			return false;
+		}
+
+		const Instruction *instruction = Assembler::instruction(instructionID);
+		const Operand::Type allowed[3] = {instruction->getFirstOperand(), instruction->getSecondOperand(), instruction->getThirdOperand()};
+
+		for(int i = 0; i < 3; i++)
+		{
+			switch(operand[i].type)
+			{
+			case Operand::MEM32:	f = 0;	break;
+			case Operand::MEM64:	f = 1;	break;
+			case Operand::MEM128:	f = 2;	break;
+			default:				continue;
+			}
+
+			if(writesOperand(instructionID, i) || (allowed[i] & registerType[f]) != registerType[f])
+			{
+				continue;
+			}
+
+			for(unsigned int cached = registerFile[f].cached; cached; cached &= cached - 1)
+			{
+				const int r = lowestBit(cached);
+
+				if(sameAddress(registerFile[f].memory[r], operand[i]))
+				{
+					switch(f)
+					{
+					case 0: operand[i] = operand32(r); break;
+					case 1: operand[i] = operand64(r); break;
+					case 2: operand[i] = operand128(r); break;
+					}
+
+					statistics.reusedLoads++;
+
+					break;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void CodeGenerator::updateLoads(int instructionID, const Operand *original, const Operand *operand, const unsigned int *written)
+	{
+		if(clobbersMemory(instructionID, operand[0]))
+		{
+			invalidateLoads();
+
+			return;
+		}
+
+		if(semantics(instructionID) & (InstructionSet::X87 | InstructionSet::EMPTIES_MMX))
+		{
+			registerFile[1].cached = 0;   // x87 state overlaps the MMX registers
+		}
+
+		for(int f = 0; f < 3; f++)
+		{
+			RegisterFile &file = registerFile[f];
+
+			file.cached &= ~written[f];
+
+			for(unsigned int cached = file.cached; cached; cached &= cached - 1)
+			{
+				const int r = lowestBit(cached);
+				const Operand &memory = file.memory[r];
+
+				// Address registers changed
+				if((memory.baseReg != Encoding::REG_UNKNOWN && written[0] >> memory.baseReg & 1) ||
+				   (memory.indexReg != Encoding::REG_UNKNOWN && written[0] >> memory.indexReg & 1))
+				{
+					file.cached &= ~(1 << r);
+					continue;
+				}
+
+				for(int i = 0; i < 3; i++)
+				{
+					if(Operand::isMem(operand[i]) && !Operand::isVoid(operand[i]) && writesOperand(instructionID, i) && mayAlias(memory, operand[i]))
+					{
+						file.cached &= ~(1 << r);
+					}
+				}
+			}
+		}
+
+		// Loads, and stores which leave the value in the register
+		int f = moveFile(instructionID, original[0], original[1]);
+
+		if(f != -1)
+		{
+			if(f != 0 || (original[1].baseReg != original[0].reg && original[1].indexReg != original[0].reg))
+			{
+				registerFile[f].cached |= 1 << original[0].reg;
+				registerFile[f].memory[original[0].reg] = original[1];
+			}
+		}
+		else if((f = moveFile(instructionID, original[1], original[0])) != -1)
+		{
+			registerFile[f].cached |= 1 << original[1].reg;
+			registerFile[f].memory[original[1].reg] = original[0];
+		}
+	}
+
+	void CodeGenerator::writtenRegister(const Operand &operand, unsigned int *written)
+	{
+		if(operand.isSubtypeOf(Operand::REG8))
+		{
+			written[0] |= 1 << (operand.reg & 3);   // AH to BH
+		}
+		else if(operand.isSubtypeOf(Operand::REG16) || operand.isSubtypeOf(Operand::REG32))
+		{
+			written[0] |= 1 << operand.reg;
+		}
+		else if(operand.isSubtypeOf(Operand::MMREG))
+		{
+			written[1] |= 1 << operand.reg;
+		}
+		else if(operand.isSubtypeOf(Operand::XMMREG))
+		{
+			written[2] |= 1 << operand.reg;
+		}
+	}
+
+	void CodeGenerator::writtenRegisters(int instructionID, const Operand &firstOperand, const Operand &secondOperand, unsigned int *written)
+	{
+		written[0] = implicitRegisters(instructionID, firstOperand, secondOperand);
+		written[1] = 0;
+		written[2] = 0;
+
+		if(writesOperand(instructionID, 0))
+		{
+			writtenRegister(firstOperand, written);
+		}
+
+		if(writesOperand(instructionID, 1))
+		{
+			writtenRegister(secondOperand, written);
+		}
+	}
+
+	int CodeGenerator::moveFile(int instructionID, const Operand &reg, const Operand &memory)
+	{
+		if(Operand::isVoid(reg) || memory.reference)
+		{
+			return -1;
+		}
+
+		const int flags = semantics(instructionID);
+
+		if(memory.type == Operand::MEM32 && reg.isSubtypeOf(Operand::REG32) && flags & InstructionSet::MOVE32)
+		{
+			return 0;
+		}
+
+		if(memory.type == Operand::MEM64 && reg.isSubtypeOf(Operand::MMREG) && flags & InstructionSet::MOVE64)
+		{
+			return 1;
+		}
+
+		if(memory.type == Operand::MEM128 && reg.isSubtypeOf(Operand::XMMREG) && flags & InstructionSet::MOVE128)
+		{
+			return 2;
+		}
+
+		return -1;
+	}
+
+	bool CodeGenerator::sameAddress(const Operand &memory1, const Operand &memory2)
+	{
+		return memory1.type == memory2.type &&
+		       !memory1.reference && !memory2.reference &&
+		       memory1.baseReg == memory2.baseReg &&
+		       memory1.indexReg == memory2.indexReg &&
+		       memory1.scale == memory2.scale &&
+		       memory1.displacement == memory2.displacement;
+	}
+
+	bool CodeGenerator::mayAlias(const Operand &memory1, const Operand &memory2)
+	{
+		if(memory1.reference || memory2.reference ||
+		   memory1.baseReg != memory2.baseReg ||
+		   memory1.indexReg != memory2.indexReg ||
+		   memory1.scale != memory2.scale)
+		{
+			return true;
+		}
+
+		return (unsigned int)(memory1.displacement - memory2.displacement) < (unsigned int)memorySize(memory2) ||
+		       (unsigned int)(memory2.displacement - memory1.displacement) < (unsigned int)memorySize(memory1);
+	}
+
+	int CodeGenerator::memorySize(const Operand &memory)
+	{
+		switch(memory.type)
+		{
+		case Operand::MEM8:		return 1;
+		case Operand::MEM16:	return 2;
+		case Operand::MEM32:	return 4;
+		case Operand::MEM64:	return 8;
+		case Operand::MEM128:	return 16;
+		default:				return 512;   // FXSAVE area
+		}
+	}
+
+	bool CodeGenerator::clobbersMemory(int instructionID, const Operand &firstOperand)
+	{
+		const int flags = semantics(instructionID);
+
+		// String instructions
+		return (flags & InstructionSet::BARRIER) || ((flags & InstructionSet::STRING_STORE) && Operand::isVoid(firstOperand));
+	}
+
+	bool CodeGenerator::usesMMX(const Operand *operand)
+	{
+		for(int i = 0; i < 3; i++)
+		{
+			if(!Operand::isVoid(operand[i]) && operand[i].isSubtypeOf(Operand::MMREG))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool CodeGenerator::emptiesMMX(int instructionID)
+	{
+		return (semantics(instructionID) & InstructionSet::EMPTIES_MMX) != 0;
+	}
+
+	bool CodeGenerator::needsEmptyMMX(int instructionID)
+	{
+		return (semantics(instructionID) & InstructionSet::NEEDS_EMPTY_MMX) != 0;
+	}
+
+	bool CodeGenerator::jumpsToEmpty(int instructionID, const Operand &firstOperand) const
+	{
+		if(!(semantics(instructionID) & InstructionSet::BRANCH) || !firstOperand.reference)
+		{
+			return false;
+		}
+
+		for(DefinedList *d = defined; d && d->next(); d = d->next())
+		{
+			if(strcmp(d->label, firstOperand.reference) == 0)
+			{
+				return d->empty;
+			}
+		}
+
+		return false;   // Forward, the label assumes MMX state
+	}
+
+	bool CodeGenerator::writesOperand(int instructionID, int i)
+	{
+		if(i == 0)
+		{
+			return !(semantics(instructionID) & InstructionSet::READS_FIRST);
+		}
+		else if(i == 1)
+		{
+			return (semantics(instructionID) & InstructionSet::WRITES_SECOND) != 0;
+		}
+
+		return false;
+	}
+
+	int CodeGenerator::writeOnly(const Recorded &entry)
+	{
+		if(entry.instructionID < 0 || !Operand::isReg(entry.operand[0]) || Operand::isVoid(entry.operand[0]))
+		{
+			return 0;
+		}
+
+		const int flags = semantics(entry.instructionID);
+
+		// Result doesn't depend on the register's value
+		if(Operand::isReg(entry.operand[1]) && !Operand::isVoid(entry.operand[1]) && entry.operand[1].reg == entry.operand[0].reg && entry.operand[1].type == entry.operand[0].type)
+		{
+			if(flags & InstructionSet::ZERO_IDIOM)
+			{
+				return 2;
+			}
+		}
+
+		if(flags & InstructionSet::OVERWRITE)
+		{
+			return 1;
+		}
+
+		// Scalar moves only clear the upper elements when loading from memory
+		if(flags & InstructionSet::SCALAR_MOVE && Operand::isMem(entry.operand[1]))
+		{
+			return 1;
+		}
+
+		if(flags & InstructionSet::MULTIPLY && !Operand::isVoid(entry.operand[2]))
+		{
+			return 1;
+		}
+
+		return 0;
+	}
+
+	int CodeGenerator::copyFile(int instructionID, const Operand &destination, const Operand &source)
+	{
+		if(!Operand::isReg(destination) || !Operand::isReg(source) || Operand::isVoid(destination) || Operand::isVoid(source))
+		{
+			return -1;
+		}
+
+		const int flags = semantics(instructionID);
+
+		if(flags & InstructionSet::MOVE32 && destination.isSubtypeOf(Operand::REG32) && source.isSubtypeOf(Operand::REG32))
+		{
+			return 0;
+		}
+
+		if(flags & InstructionSet::MOVE64 && destination.isSubtypeOf(Operand::MMREG) && source.isSubtypeOf(Operand::MMREG))
+		{
+			return 1;
+		}
+
+		if(flags & InstructionSet::MOVE128 && destination.isSubtypeOf(Operand::XMMREG) && source.isSubtypeOf(Operand::XMMREG))
+		{
+			return 2;
+		}
+
+		return -1;
+	}
+
+	int CodeGenerator::virtualIndex(Encoding::Reg reg)
+	{
+		return (int)reg >= VIRTUAL ? (int)reg - VIRTUAL : -1;
+	}
+
+	bool CodeGenerator::member(const unsigned int *set, int words, int p, int id)
+	{
+		return (set[p * words + id / 32] >> id % 32 & 1) != 0;
+	}
+
+	unsigned int CodeGenerator::implicitRegisters(int instructionID, const Operand &firstOperand, const Operand &secondOperand)
+	{
+		const int flags = semantics(instructionID);
+
+		if(flags & InstructionSet::MULTIPLY && Operand::isVoid(secondOperand))
+		{
+			return 1 << Encoding::EAX | 1 << Encoding::EDX;
+		}
+
+		// String instructions, possibly repeated
+		if(flags & InstructionSet::STRING && Operand::isVoid(firstOperand))
+		{
+			return 1 << Encoding::EAX | 1 << Encoding::ECX | 1 << Encoding::ESI | 1 << Encoding::EDI;
+		}
+
+		return Assembler::implicitRegisters(instructionID);
+	}
+}
\ No newline at end of file
@@ -2,14 +2,27 @@
 #define SoftWire_CodeGenerator_hpp
 
 #include "Assembler.hpp"
+#include "Link.hpp"
 
 namespace SoftWire
 {
 	class CodeGenerator : public Assembler
 	{
 	public:
+		struct Statistics
+		{
+			int peakRegisters[3];   // Most registers in use at once, per register file
+			int spills;   // Register values written back to memory
+			int reloads;   // Values loaded into registers
+			int evictions;   // Values moved out for another one, by priority or spill cost
+			int explicitSpills;   // Registers released through spill() and spillAll()
+			int reusedLoads;   // Memory reads served by a register already holding the value
+		};
+
 		CodeGenerator();
 
+		~CodeGenerator();
+
 		const OperandREG32 &r32(const OperandREF &ref, bool copy = true);
 		const OperandREG32 &x32(const OperandREF &ref, bool copy = false);
 		const OperandREG32 &t32(int i);
@@ -42,62 +55,187 @@ namespace SoftWire
 
 		bool real(const OperandREF &ref);
 
+		// Saves the callee-saved registers the routine writes, and sets up a stack
+		// frame with slots for spilling temporaries when needed, claims ebp
+		void prologue();
+		void epilogue();
+		const OperandMEM32 argument(int i);   // Stack argument, at a fixed ebp offset after the prologue
+
 		void free(const OperandREF &ref);
 		void spill(const OperandREF &ref);
 
 		void freeAll();
 		void spillAll();
 
+		// Record the routine and allocate its registers with linear scan at the end
+		void beginRecording();
+		void endRecording();
+
+		void label(const char *label);
+
+		// Registers still holding a loaded or stored value replace later reads of that memory
+		void invalidateLoads();   // Memory changed behind the generator's back
+
+		// Emms before x87 instructions, calls and returns that follow MMX code, on by default
+		void automaticEmms(bool enable = true);
+		void warnMMX(bool warn = true);   // Annotates MMX instructions with an SSE2 equivalent
+
+		// Since construction, the prologue or the last reset, the epilogue annotates them
+		const Statistics &getStatistics() const;
+		void resetStatistics();
+		void annotateStatistics();
+
+	protected:
+		int x86(int instructionID,
+		        const Operand &firstOperand = VOID,
+		        const Operand &secondOperand = VOID,
+		        const Operand &thirdOperand = VOID);   // Tracks modified registers
+
 	private:
-		OperandREF physicalEAX;
-		OperandREF physicalECX;
-		OperandREF physicalEDX;
-		OperandREF physicalEBX;
-		OperandREF physicalESI;
-		OperandREF physicalEDI;
-
-		OperandREF physicalMM0;
-		OperandREF physicalMM1;
-		OperandREF physicalMM2;
-		OperandREF physicalMM3;
-		OperandREF physicalMM4;
-		OperandREF physicalMM5;
-		OperandREF physicalMM6;
-		OperandREF physicalMM7;
-
-		OperandREF physicalXMM0;
-		OperandREF physicalXMM1;
-		OperandREF physicalXMM2;
-		OperandREF physicalXMM3;
-		OperandREF physicalXMM4;
-		OperandREF physicalXMM5;
-		OperandREF physicalXMM6;
-		OperandREF physicalXMM7;
-
-		unsigned int priorityEAX;
-		unsigned int priorityECX;
-		unsigned int priorityEDX;
-		unsigned int priorityEBX;
-		unsigned int priorityESI;
-		unsigned int priorityEDI;
-
-		unsigned int priorityMM0;
-		unsigned int priorityMM1;
-		unsigned int priorityMM2;
-		unsigned int priorityMM3;
-		unsigned int priorityMM4;
-		unsigned int priorityMM5;
-		unsigned int priorityMM6;
-		unsigned int priorityMM7;
-
-		unsigned int priorityXMM0;
-		unsigned int priorityXMM1;
-		unsigned int priorityXMM2;
-		unsigned int priorityXMM3;
-		unsigned int priorityXMM4;
-		unsigned int priorityXMM5;
-		unsigned int priorityXMM6;
-		unsigned int priorityXMM7;
+		enum {VIRTUAL = 0x100};   // Register numbers handed out while recording
+		enum {LABEL = -1, WRITE_BACK = -2};
+		enum {MAX_REGISTERS = 32};   // Per register file, for 32-bit masks
+		enum {FRAME_SIZE = 8 * 16 + 8 * 8 + 8 * 4, FRAME_ALIGNMENT = 16};
+
+		struct Virtual
+		{
+			OperandREG32 reg32;
+			OperandMMREG reg64;
+			OperandXMMREG reg128;
+
+			OperandREF ref;
+			int file;   // 0 for general purpose, 1 for MMX, 2 for SSE registers
+			bool copy;
+			bool live;   // Not spilled or freed yet
+			bool store;   // Write back at the end of the range
+
+			int first;   // Live range, in recorded entries
+			int last;
+			unsigned int cost;   // Uses weighted by loop depth
+			int physical;   // -1 when kept in memory
+			bool stackable;   // Temporary with a stack slot of its own
+			bool coalesced;   // Took over the register of the range it was copied from
+			bool handover;   // Register passes on to a copy at the end of the range
+		};
+
+		struct Recorded
+		{
+			int instructionID;   // Or LABEL, or WRITE_BACK of the first operand
+			Operand operand[3];
+			char *reference[3];
+			char *label;   // Defined or jumped to
+			int depth;   // Loop nesting
+		};
+
+		struct Defined
+		{
+			char *label;
+			bool open;   // No MMX since the label, code there assumes the FPU state is empty
+			bool empty;   // x87 code followed while open
+		};
+
+		typedef Link<Virtual> VirtualList;
+		typedef Link<Recorded> RecordedList;
+		typedef Link<Defined> DefinedList;
+
+		bool recording;
+		VirtualList *virtuals;
+		VirtualList *virtualTail;
+		RecordedList *recorded;
+		int numVirtuals;
+		int numRecorded;
+
+		bool temporary(const OperandREF &ref);
+		bool spillable(const OperandREF &ref);
+		const OperandREF address(int file, const OperandREF &ref);
+
+		int findRegister(int file, const OperandREF &ref) const;
+		int allocateRegister(int file, const OperandREF &ref, bool copy);
+		int assignRegister(int file, int physical, const OperandREF &ref, bool copy);
+		int accessRegister(int file, int physical);
+		void freeRegister(int file, int physical);
+		void spillRegister(int file, int physical);
+
+		static const OperandREG32 &operand32(int physical);
+		static const OperandMMREG &operand64(int physical);
+		static const OperandXMMREG &operand128(int physical);
+		static int bitCount(unsigned int mask);
+		void notePressure(int file, int count);
+
+		Virtual *findVirtual(const OperandREF &ref, int file);
+		Virtual &virtualRegister(const OperandREF &ref, int file, bool copy);
+		void release(Virtual &v, bool store);
+		void release(const OperandREF &ref, bool store);
+		void release(int id, bool store);
+		void releaseAll(bool store);
+		void linearScan();
+		void liveness(Recorded **entry, int n, Virtual **table, const int *target, unsigned int *liveIn, unsigned int *liveOut, unsigned int *read);
+		void emitRecorded(Recorded **entry, int n, Virtual **table, const int *target, const unsigned int (*fixed)[3], const unsigned int *liveIn, const unsigned int *liveOut, const unsigned int *read);
+		void discardRecording();
+
+		void load(int file, int physical, const OperandREF &ref);
+		void store(int file, int physical, const OperandREF &ref);
+		unsigned int &dirty(int file);
+
+		bool reuseLoads(int instructionID, Operand *operand);
+		void updateLoads(int instructionID, const Operand *original, const Operand *operand, const unsigned int *written);
+
+		static void writtenRegister(const Operand &operand, unsigned int *written);
+		static void writtenRegisters(int instructionID, const Operand &firstOperand, const Operand &secondOperand, unsigned int *written);
+		static int moveFile(int instructionID, const Operand &reg, const Operand &memory);
+		static bool sameAddress(const Operand &memory1, const Operand &memory2);
+		static bool mayAlias(const Operand &memory1, const Operand &memory2);
+		static int memorySize(const Operand &memory);
+		static bool clobbersMemory(int instructionID, const Operand &firstOperand);
+		static bool usesMMX(const Operand *operand);
+		static bool emptiesMMX(int instructionID);
+		static bool needsEmptyMMX(int instructionID);
+		bool jumpsToEmpty(int instructionID, const Operand &firstOperand) const;
+
+		static bool cover(int &first, int &last, int lo, int hi);
+		static void fixRegister(unsigned int (*fixed)[3], int *previous, int file, int physical, int p, bool read);
+		static bool coverFixed(unsigned int (*fixed)[3], int n, int file, int physical, int lo, int hi);
+		static bool fixedWithin(const unsigned int (*fixed)[3], int file, int physical, int first, int last);
+		static bool uses(const Recorded &entry, int id);
+		static bool writesOperand(int instructionID, int i);
+		static int writeOnly(const Recorded &entry);
+		static int copyFile(int instructionID, const Operand &destination, const Operand &source);
+		static int virtualIndex(Encoding::Reg reg);   // -1 for physical registers
+		static bool member(const unsigned int *set, int words, int p, int id);
+		static unsigned int implicitRegisters(int instructionID, const Operand &firstOperand, const Operand &secondOperand);
+
+		struct RegisterFile
+		{
+			int count;   // Encodable registers
+			unsigned int available;   // Bit per Encoding::Reg
+			unsigned int allocated;
+			unsigned int dirty;   // Written since they were loaded
+			unsigned int stacked;   // Temporaries spilled to their stack slot
+			unsigned int cached;   // Holding the value at memory[r]
+
+			OperandREF physical[MAX_REGISTERS];
+			unsigned int priority[MAX_REGISTERS];
+			Operand memory[MAX_REGISTERS];
+		};
+
+		RegisterFile registerFile[3];   // General purpose, MMX and SSE
+		bool framed;
+
+		// Since the prologue
+		unsigned int touched;   // General purpose registers written
+		bool called;
+		bool slotted;   // Stack slots used
+		bool argued;   // Arguments read through ebp
+		Encoding *frameCode[7];   // Prologue, removed where not needed
+
+		bool autoEmms;
+		bool mmxWarnings;
+		bool mmxState;   // MMX used since the last emms
+		bool mmxUsed;   // Anywhere since the prologue, other paths may reach labels with MMX state
+		DefinedList *defined;   // Labels, for backward jumps
+		bool openLabels;
+
+		Statistics statistics;
 	};
 }
 
@@ -0,0 +1,759 @@
+#include "Disassembler.hpp"
+
+#include "InstructionSet.hpp"
+#include "Instruction.hpp"
+#include "Error.hpp"
+#include "String.hpp"
+
+#include <stdlib.h>
+
+namespace SoftWire
+{
+	Disassembler::Disassembler(InstructionSet &instructionSet) : instructionSet(instructionSet)
+	{
+		labels = 0;
+
+		for(int b = 0; b < 256; b++)
+		{
+			table[b] = 0;
+			vexTable[b] = 0;
+		}
+
+		const int n = InstructionSet::numInstructions();
+		patterns = new Pattern[n];
+
+		// Insert in reverse so that every chain keeps the order of the instruction table
+		for(int i = n - 1; i >= 0; i--)
+		{
+			Pattern &pattern = patterns[i];
+
+			if(!parsePattern(pattern, instructionSet.instruction(i)))
+			{
+				continue;
+			}
+
+			assignOperands(pattern);
+
+			Pattern **bucket = pattern.VEX ? &vexTable[pattern.opcode[0]] : &table[pattern.opcode[0]];
+
+			pattern.next = *bucket;
+			*bucket = &pattern;
+		}
+	}
+
+	Disassembler::~Disassembler()
+	{
+		delete[] patterns;
+		patterns = 0;
+
+		clearLabels();
+	}
+
+	void Disassembler::defineLabel(const unsigned char *address, const char *name)
+	{
+		if(!labels)
+		{
+			labels = new LabelTable();
+		}
+
+		labels->append(Label(address, name));
+	}
+
+	void Disassembler::clearLabels()
+	{
+		delete labels;
+		labels = 0;
+	}
+
+	bool Disassembler::parsePattern(Pattern &pattern, const Instruction *instruction) const
+	{
+		pattern.instruction = instruction;
+		pattern.prefixes = 0;
+		pattern.opcodeLength = 0;
+		pattern.addReg = false;
+		pattern.modRM = -1;
+		pattern.immediate = 0;
+		pattern.relative = false;
+		pattern.hasSuffix = false;
+		pattern.VEX = false;
+		pattern.map = 0;
+		pattern.pp = 0;
+		pattern.vexOperand = -1;
+		pattern.next = 0;
+
+		const char *format = instruction->getEncoding();
+
+		if(!format)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		// Opcode bytes are assigned like Synthesizer::encodeInstruction does
+		bool O1 = false;
+		bool O2 = false;
+		bool O3 = false;
+		bool fwait = false;
+		unsigned char o1 = 0;
+		unsigned char o2 = 0;
+		unsigned char o3 = 0;
+		int vexEscape = 0;
+
+		while(*format)
+		{
+			switch((format[0] << 8) | format[1])
+			{
+			case LOCK_PRE:
+				pattern.prefixes |= PREFIX_LOCK;
+				break;
+			case CONST_PRE:
+				return false;   // Data
+			case REPNE_PRE:
+				if(pattern.VEX) pattern.pp = 3;
+				else pattern.prefixes |= PREFIX_REPNE;
+				break;
+			case REP_PRE:
+				if(pattern.VEX) pattern.pp = 2;
+				else pattern.prefixes |= PREFIX_REP;
+				break;
+			case OFF_PRE:
+				if(!instruction->is32Bit() || wordOperand(instruction)) pattern.prefixes |= PREFIX_OFF;
+				break;
+			case ADDR_PRE:
+				if(!instruction->is32Bit()) pattern.prefixes |= PREFIX_ADDR;
+				break;
+			case VEX_0:
+			case VEX_1:
+			case VEX_2:
+			case VEX_3:
+				pattern.VEX = true;
+				pattern.vexOperand = format[1] - '0' - 1;
+				break;
+			case ADD_REG:
+				pattern.addReg = true;
+				break;
+			case EFF_ADDR:
+				pattern.modRM = 8;
+				break;
+			case MOD_RM_0:
+			case MOD_RM_1:
+			case MOD_RM_2:
+			case MOD_RM_3:
+			case MOD_RM_4:
+			case MOD_RM_5:
+			case MOD_RM_6:
+			case MOD_RM_7:
+				pattern.modRM = format[1] - '0';
+				break;
+			case DWORD_IMM:
+				pattern.immediate = 4;
+				break;
+			case WORD_IMM:
+				if(pattern.immediate < 2) pattern.immediate = 2;
+				break;
+			case BYTE_IMM:
+				if(pattern.immediate < 1) pattern.immediate = 1;
+				break;
+			case BYTE_REL:
+				pattern.immediate = 1;
+				pattern.relative = true;
+				break;
+			case DWORD_REL:
+				pattern.immediate = 4;
+				pattern.relative = true;
+				break;
+			default:
+				unsigned char opcode = (unsigned char)strtoul(format, 0, 16);
+
+				if(pattern.VEX && !O1)
+				{
+					if(vexEscape == 0 && opcode == 0x66)		pattern.pp = 1;
+					else if(vexEscape == 0 && opcode == 0x0F)	{pattern.map = 1; vexEscape = 1;}
+					else if(vexEscape == 1 && opcode == 0x38)	{pattern.map = 2; vexEscape = 2;}
+					else if(vexEscape == 1 && opcode == 0x3A)	{pattern.map = 3; vexEscape = 2;}
+					else										{o1 = opcode; O1 = true;}
+				}
+				else if(!O1 && opcode == 0x66)
+				{
+					pattern.prefixes |= PREFIX_OFF;
+				}
+				else if(!O1)
+				{
+					o1 = opcode;
+					O1 = true;
+				}
+				else if(!O2 && (o1 == 0x0F || (o1 >= 0xD8 && o1 <= 0xDF)))
+				{
+					o2 = o1;
+					o1 = opcode;
+					O2 = true;
+				}
+				else if(o1 == 0x9B)   // FWAIT
+				{
+					fwait = true;
+					o1 = opcode;
+				}
+				else if(!O3 && O2 && o2 == 0x0F && (o1 == 0x38 || o1 == 0x3A))
+				{
+					o3 = o2;
+					o2 = o1;
+					o1 = opcode;
+					O3 = true;
+				}
+				else
+				{
+					pattern.suffix = opcode;
+					pattern.hasSuffix = true;
+				}
+			}
+
+			format += 2;
+
+			if(*format == ' ')
+			{
+				format++;
+			}
+		}
+
+		if(!O1 || (pattern.hasSuffix && pattern.immediate))
+		{
+			return false;
+		}
+
+		if(fwait)	pattern.opcode[pattern.opcodeLength++] = 0x9B;
+		if(O3)		pattern.opcode[pattern.opcodeLength++] = o3;
+		if(O2)		pattern.opcode[pattern.opcodeLength++] = o2;
+		pattern.opcode[pattern.opcodeLength++] = o1;
+
+		return true;
+	}
+
+	void Disassembler::assignOperands(Pattern &pattern) const
+	{
+		pattern.operand[0] = pattern.instruction->getFirstOperand();
+		pattern.operand[1] = pattern.instruction->getSecondOperand();
+		pattern.operand[2] = pattern.instruction->getThirdOperand();
+
+		pattern.regOperand = -1;
+		pattern.r_mOperand = -1;
+		pattern.addRegOperand = -1;
+
+		// Operands left for mod R/M after taking out the VEX register
+		int remaining[3] = {0, 1, 2};
+
+		if(pattern.vexOperand >= 0)
+		{
+			for(int i = pattern.vexOperand; i < 2; i++)
+			{
+				remaining[i] = i + 1;
+			}
+		}
+
+		const int first = remaining[0];
+		const int second = remaining[1];
+
+		const Operand::Type firstSyntax = pattern.operand[first];
+		const Operand::Type secondSyntax = pattern.operand[second];
+
+		if(pattern.modRM == 8)
+		{
+			if(Operand::isReg(firstSyntax) && Operand::isR_M(secondSyntax))
+			{
+				pattern.regOperand = first;
+				pattern.r_mOperand = second;
+			}
+			else if(Operand::isR_M(firstSyntax) && Operand::isReg(secondSyntax))
+			{
+				pattern.r_mOperand = first;
+				pattern.regOperand = second;
+			}
+			else if(Operand::isReg(firstSyntax) && Operand::isImm(secondSyntax))   // IMUL working on the same register
+			{
+				pattern.r_mOperand = first;
+			}
+		}
+		else if(pattern.modRM >= 0)
+		{
+			if(Operand::isReg(firstSyntax) && Operand::isR_M(secondSyntax))
+			{
+				pattern.r_mOperand = second;
+			}
+			else
+			{
+				pattern.r_mOperand = first;
+			}
+		}
+
+		if(pattern.addReg)
+		{
+			for(int i = 0; i < 3; i++)
+			{
+				const Operand::Type type = pattern.operand[i];
+
+				if(type != Operand::VOID && Operand::isReg(type) && !regName(type, -1))
+				{
+					pattern.addRegOperand = i;
+					break;
+				}
+			}
+		}
+	}
+
+	int Disassembler::disassemble(const unsigned char *code, int length, char *buffer) const
+	{
+		int prefixes = 0;
+		int i = 0;
+
+		for(; i < length && i < 4; i++)
+		{
+			if(code[i] == 0xF0)			prefixes |= PREFIX_LOCK;
+			else if(code[i] == 0xF2)	prefixes |= PREFIX_REPNE;
+			else if(code[i] == 0xF3)	prefixes |= PREFIX_REP;
+			else if(code[i] == 0x66)	prefixes |= PREFIX_OFF;
+			else if(code[i] == 0x67)	prefixes |= PREFIX_ADDR;
+			else break;
+		}
+
+		// In 32-bit mode C4 is LES unless the next byte would be a register operand
+		const bool VEX = i + 3 < length && code[i] == 0xC4 && (code[i + 1] & 0xC0) == 0xC0;
+		const int opcodeStart = VEX ? i + 3 : i;
+
+		if(opcodeStart >= length)
+		{
+			strcpy(buffer, "db ");
+			printNumber(buffer + 3, code[0]);
+			return 1;
+		}
+
+		const unsigned char first = code[opcodeStart];
+		const Pattern *bucket[2];
+
+		bucket[0] = VEX ? vexTable[first] : table[first];
+		bucket[1] = !VEX && (first & 0x07) ? table[first & 0xF8] : 0;   // '+r' opcodes
+
+		const Pattern *best = 0;
+		int bestScore = -1;
+		int bestLength = 0;
+		int bestModRM = 0;
+
+		for(int k = 0; k < 2; k++)
+		{
+			for(const Pattern *pattern = bucket[k]; pattern; pattern = pattern->next)
+			{
+				int j = opcodeStart;
+
+				if(VEX)
+				{
+					if(prefixes ||
+					   (code[i + 1] & 0x1F) != pattern->map ||
+					   (code[i + 2] & 0x03) != pattern->pp ||
+					   (code[i + 2] & 0x84) != 0)   // W and L
+					{
+						continue;
+					}
+
+					j++;
+				}
+				else
+				{
+					if(pattern->VEX || (pattern->prefixes & ~prefixes) || j + pattern->opcodeLength > length)
+					{
+						continue;
+					}
+
+					int n = 0;
+
+					for(; n < pattern->opcodeLength; n++)
+					{
+						unsigned char byte = code[j + n];
+
+						if(n == pattern->opcodeLength - 1 && pattern->addReg)
+						{
+							byte &= 0xF8;
+						}
+
+						if(byte != pattern->opcode[n])
+						{
+							break;
+						}
+					}
+
+					if(n != pattern->opcodeLength)
+					{
+						continue;
+					}
+
+					j += pattern->opcodeLength;
+				}
+
+				const int modRM = j;
+
+				if(pattern->modRM >= 0)
+				{
+					if(j >= length)
+					{
+						continue;
+					}
+
+					const int mod = code[j] >> 6;
+
+					if(pattern->modRM < 8 && ((code[j] >> 3) & 0x07) != pattern->modRM)
+					{
+						continue;
+					}
+
+					if(pattern->modRM == 8 && pattern->regOperand < 0 && ((code[j] >> 3) & 0x07) != (code[j] & 0x07))   // Same register twice
+					{
+						continue;
+					}
+
+					if(pattern->r_mOperand >= 0)
+					{
+						const Operand::Type type = pattern->operand[pattern->r_mOperand];
+
+						if((mod == 3 && !(type & Operand::REG)) || (mod != 3 && !(type & Operand::MEM)))
+						{
+							continue;
+						}
+					}
+
+					const int n = modRMLength(&code[j], length - j);
+
+					if(n < 0)
+					{
+						continue;
+					}
+
+					j += n;
+				}
+
+				if(pattern->hasSuffix)
+				{
+					if(j >= length || code[j] != pattern->suffix)
+					{
+						continue;
+					}
+
+					j++;
+				}
+
+				j += pattern->immediate;
+
+				if(j > length)
+				{
+					continue;
+				}
+
+				int score = 4 * pattern->opcodeLength;
+
+				for(int p = pattern->prefixes; p; p &= p - 1) score += 16;
+				if(pattern->modRM >= 0 && pattern->modRM < 8) score += 2;
+				if(pattern->hasSuffix) score += 4;
+
+				if(score > bestScore)
+				{
+					best = pattern;
+					bestScore = score;
+					bestLength = j;
+					bestModRM = modRM;
+				}
+			}
+		}
+
+		if(!best || (prefixes & ~best->prefixes))
+		{
+			strcpy(buffer, "db ");
+			printNumber(buffer + 3, code[0]);
+			return 1;
+		}
+
+		char *output = buffer;
+
+		for(const char *mnemonic = best->instruction->getMnemonic(); *mnemonic; mnemonic++)
+		{
+			*output++ = tolower(*mnemonic);
+		}
+
+		for(int n = 0; n < 3; n++)
+		{
+			if(best->operand[n] == Operand::VOID)
+			{
+				break;
+			}
+
+			*output++ = n == 0 ? ' ' : ',';
+			if(n != 0) *output++ = ' ';
+
+			output = printOperand(output, *best, n, code, bestModRM, bestLength - best->immediate, bestLength);
+		}
+
+		*output = '\0';
+
+		return bestLength;
+	}
+
+	char *Disassembler::printOperand(char *buffer, const Pattern &pattern, int i, const unsigned char *code, int modRM, int immediate, int length) const
+	{
+		const Operand::Type type = pattern.operand[i];
+
+		if(i == pattern.vexOperand)
+		{
+			return buffer + sprintf(buffer, "%s", regName(type, (~code[modRM - 2] >> 3) & 0x07));
+		}
+		else if(i == pattern.addRegOperand)
+		{
+			return buffer + sprintf(buffer, "%s", regName(type, code[modRM - 1] & 0x07));
+		}
+		else if(i == pattern.r_mOperand)
+		{
+			if((code[modRM] >> 6) == 3)
+			{
+				return buffer + sprintf(buffer, "%s", regName(type, code[modRM] & 0x07));
+			}
+
+			return printMemory(buffer, type, &code[modRM]);
+		}
+		else if(i == pattern.regOperand)
+		{
+			return buffer + sprintf(buffer, "%s", regName(type, (code[modRM] >> 3) & 0x07));
+		}
+		else if(type == Operand::ONE)
+		{
+			return buffer + sprintf(buffer, "1");
+		}
+		else if(regName(type, -1))
+		{
+			return buffer + sprintf(buffer, "%s", regName(type, -1));
+		}
+		else if(Operand::isImm(type))
+		{
+			int value = 0;
+
+			switch(pattern.immediate)
+			{
+			case 1:
+				value = (type == Operand::IMM8 && !pattern.relative) ? code[immediate] : (char)code[immediate];
+				break;
+			case 2:
+				value = *(unsigned short*)&code[immediate];
+				break;
+			case 4:
+				value = *(int*)&code[immediate];
+				break;
+			}
+
+			const unsigned char *address = pattern.relative ? &code[length] + value : (const unsigned char*)value;
+			const char *label = (pattern.relative || pattern.immediate == 4) ? labelName(address) : 0;
+
+			if(label)
+			{
+				return buffer + sprintf(buffer, "%s", label);
+			}
+			else if(pattern.relative)
+			{
+				return buffer + sprintf(buffer, "0%.8Xh", (int)address);
+			}
+
+			return printNumber(buffer, value);
+		}
+
+		return buffer + sprintf(buffer, "?");
+	}
+
+	char *Disassembler::printMemory(char *buffer, Operand::Type type, const unsigned char *modRM) const
+	{
+		const int mod = modRM[0] >> 6;
+		int base = modRM[0] & 0x07;
+		int index = -1;
+		int scale = 1;
+		const unsigned char *displacement = &modRM[1];
+
+		if(base == 4)
+		{
+			const unsigned char SIB = modRM[1];
+
+			base = SIB & 0x07;
+			index = (SIB >> 3) & 0x07;
+			scale = 1 << (SIB >> 6);
+			displacement++;
+
+			if(index == 4)
+			{
+				index = -1;
+			}
+
+			if(mod == 0 && base == 5)
+			{
+				base = -1;
+			}
+		}
+		else if(mod == 0 && base == 5)
+		{
+			base = -1;
+		}
+
+		int disp = 0;
+
+		if(mod == 1)							disp = (char)displacement[0];
+		else if(mod == 2 || base == -1)			disp = *(int*)displacement;
+
+		if(type & Operand::MEM8 && !(type & ~(Operand::MEM8 | Operand::REG)))				buffer += sprintf(buffer, "byte ptr ");
+		else if(type & Operand::MEM16 && !(type & ~(Operand::MEM16 | Operand::REG)))		buffer += sprintf(buffer, "word ptr ");
+		else if(type & Operand::MEM32 && !(type & ~(Operand::MEM32 | Operand::REG)))		buffer += sprintf(buffer, "dword ptr ");
+		else if(type & Operand::MEM64 && !(type & ~(Operand::MEM64 | Operand::REG)))		buffer += sprintf(buffer, "qword ptr ");
+		else if(type & Operand::MEM128 && !(type & ~(Operand::MEM128 | Operand::REG)))		buffer += sprintf(buffer, "xmmword ptr ");
+
+		*buffer++ = '[';
+
+		if(base != -1)
+		{
+			buffer += sprintf(buffer, "%s", regName(Operand::REG32, base));
+		}
+
+		if(index != -1)
+		{
+			if(base != -1) *buffer++ = '+';
+			buffer += sprintf(buffer, "%s", regName(Operand::REG32, index));
+			if(scale != 1) buffer += sprintf(buffer, "*%d", scale);
+		}
+
+		if(base == -1 && index == -1)
+		{
+			const char *label = labelName((const unsigned char*)disp);
+
+			if(label)
+			{
+				buffer += sprintf(buffer, "%s", label);
+			}
+			else
+			{
+				buffer += sprintf(buffer, "0%.8Xh", disp);
+			}
+		}
+		else if(disp > 0)
+		{
+			*buffer++ = '+';
+			buffer = printNumber(buffer, disp);
+		}
+		else if(disp < 0)
+		{
+			buffer = printNumber(buffer, disp);
+		}
+
+		*buffer++ = ']';
+		*buffer = '\0';
+
+		return buffer;
+	}
+
+	char *Disassembler::printNumber(char *buffer, int value)
+	{
+		if(value > -10 && value < 10)
+		{
+			return buffer + sprintf(buffer, "%d", value);
+		}
+
+		if(value < 0)
+		{
+			*buffer++ = '-';
+			value = -value;
+		}
+
+		char hex[16];
+		sprintf(hex, "%X", value);
+
+		// Hexadecimal numbers can't start with a letter
+		return buffer + sprintf(buffer, hex[0] > '9' ? "0%sh" : "%sh", hex);
+	}
+
+	const char *Disassembler::regName(Operand::Type type, int reg)
+	{
+		static const char *reg8[] = {"al", "cl", "dl", "bl", "ah", "ch", "dh", "bh"};
+		static const char *reg16[] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di"};
+		static const char *reg32[] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"};
+		static const char *fpureg[] = {"st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7"};
+		static const char *mmreg[] = {"mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"};
+		static const char *xmmreg[] = {"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"};
+
+		if(reg < 0)   // Implicit register operands
+		{
+			switch(type)
+			{
+			case Operand::AL:	return "al";
+			case Operand::CL:	return "cl";
+			case Operand::AX:	return "ax";
+			case Operand::CX:	return "cx";
+			case Operand::DX:	return "dx";
+			case Operand::EAX:	return "eax";
+			case Operand::ECX:	return "ecx";
+			case Operand::ST0:	return "st0";
+			default:			return 0;
+			}
+		}
+
+		if(type & Operand::XMMREG)		return xmmreg[reg];
+		if(type & Operand::MMREG)		return mmreg[reg];
+		if(type & Operand::FPUREG)		return fpureg[reg];
+		if(type & Operand::REG32)		return reg32[reg];
+		if(type & Operand::REG16)		return reg16[reg];
+		if(type & Operand::REG8)		return reg8[reg];
+
+		return "?";
+	}
+
+	bool Disassembler::wordOperand(const Instruction *instruction)
+	{
+		const Operand::Type operand[3] = {instruction->getFirstOperand(), instruction->getSecondOperand(), instruction->getThirdOperand()};
+
+		// The first register or memory operand, other than the port, determines the size
+		for(int i = 0; i < 3 && operand[i] != Operand::VOID; i++)
+		{
+			if(operand[i] != Operand::DX && !Operand::isImm(operand[i]))
+			{
+				return Operand::isSubtypeOf(operand[i], Operand::R_M16);
+			}
+		}
+
+		return false;
+	}
+
+	const char *Disassembler::labelName(const unsigned char *address) const
+	{
+		for(const LabelTable *label = labels; label; label = label->next())
+		{
+			if(label->name && label->address == address)
+			{
+				return label->name;
+			}
+		}
+
+		return 0;
+	}
+
+	int Disassembler::modRMLength(const unsigned char *modRM, int length)
+	{
+		const int mod = modRM[0] >> 6;
+		const int r_m = modRM[0] & 0x07;
+		int n = 1;
+
+		if(mod != 3 && r_m == 4)   // SIB byte
+		{
+			if(length < 2)
+			{
+				return -1;
+			}
+
+			n++;
+
+			if(mod == 0 && (modRM[1] & 0x07) == 5)
+			{
+				n += 4;
+			}
+		}
+
+		if(mod == 0 && r_m == 5)		n += 4;
+		else if(mod == 1)				n += 1;
+		else if(mod == 2)				n += 4;
+
+		return n <= length ? n : -1;
+	}
+}
@@ -0,0 +1,92 @@
+#ifndef SoftWire_Disassembler_hpp
+#define SoftWire_Disassembler_hpp
+
+#include "Operand.hpp"
+#include "Link.hpp"
+
+namespace SoftWire
+{
+	class Instruction;
+	class InstructionSet;
+
+	class Disassembler
+	{
+	public:
+		Disassembler(InstructionSet &instructionSet);   // Shared, must outlive the disassembler
+
+		~Disassembler();
+
+		void defineLabel(const unsigned char *address, const char *name);
+		void clearLabels();
+
+		// Decodes one instruction, buffer should hold 256 characters, returns length in bytes
+		int disassemble(const unsigned char *code, int length, char *buffer) const;
+
+	private:
+		enum Prefix
+		{
+			PREFIX_LOCK = 0x01,
+			PREFIX_REPNE = 0x02,
+			PREFIX_REP = 0x04,
+			PREFIX_OFF = 0x08,
+			PREFIX_ADDR = 0x10
+		};
+
+		struct Pattern
+		{
+			const Instruction *instruction;
+
+			int prefixes;
+			unsigned char opcode[4];   // Following the prefixes
+			int opcodeLength;
+			bool addReg;
+			int modRM;   // Register field value, 8 for /r, -1 when absent
+			int immediate;   // Bytes
+			bool relative;
+			unsigned char suffix;   // Opcode byte in immediate position (3DNow!)
+			bool hasSuffix;
+
+			bool VEX;
+			int map;
+			int pp;
+
+			Operand::Type operand[3];
+			int regOperand;
+			int r_mOperand;
+			int vexOperand;
+			int addRegOperand;
+
+			Pattern *next;   // Same first opcode byte
+		};
+
+		struct Label
+		{
+			Label(const unsigned char *address = 0, const char *name = 0) : address(address), name(name) {};
+
+			const unsigned char *address;
+			const char *name;
+		};
+
+		InstructionSet &instructionSet;
+
+		Pattern *patterns;
+		Pattern *table[256];
+		Pattern *vexTable[256];
+
+		typedef Link<Label> LabelTable;
+		LabelTable *labels;
+
+		bool parsePattern(Pattern &pattern, const Instruction *instruction) const;
+		void assignOperands(Pattern &pattern) const;
+
+		const char *labelName(const unsigned char *address) const;
+		char *printOperand(char *buffer, const Pattern &pattern, int i, const unsigned char *code, int modRM, int immediate, int length) const;
+		char *printMemory(char *buffer, Operand::Type type, const unsigned char *modRM) const;
+		static char *printNumber(char *buffer, int value);
+		static const char *regName(Operand::Type type, int reg);
+		static bool wordOperand(const Instruction *instruction);
+		static int modRMLength(const unsigned char *modRM, int length);
+	};
+}
+
+#endif   // SoftWire_Disassembler_hpp
@@ -2,6 +2,7 @@
 
 #include "Error.hpp"
 #include "String.hpp"
+#include "File.hpp"
 
 namespace SoftWire
 {
@@ -28,6 +29,9 @@ namespace SoftWire
 		P2 = encoding.P2;
 		P3 = encoding.P3;
 		P4 = encoding.P4;
+		VEX.b1 = encoding.VEX.b1;
+		VEX.b2 = encoding.VEX.b2;
+		O3 = encoding.O3;
 		O2 = encoding.O2;
 		O1 = encoding.O1;
 		modRM.b = encoding.modRM.b;
@@ -55,6 +59,9 @@ namespace SoftWire
 		P2 = encoding.P2;
 		P3 = encoding.P3;
 		P4 = encoding.P4;
+		VEX.b1 = encoding.VEX.b1;
+		VEX.b2 = encoding.VEX.b2;
+		O3 = encoding.O3;
 		O2 = encoding.O2;
 		O1 = encoding.O1;
 		modRM.b = encoding.modRM.b;
@@ -79,6 +86,8 @@ namespace SoftWire
 		format.P2 = false;
 		format.P3 = false;
 		format.P4 = false;
+		format.VEX = false;
+		format.O3 = false;
 		format.O2 = false;
 		format.O1 = false;
 		format.modRM = false;
@@ -96,6 +105,9 @@ namespace SoftWire
 		P2 = 0xCC;
 		P3 = 0xCC;
 		P4 = 0xCC;
+		VEX.b1 = 0xE1;   // No extended registers, 0F map
+		VEX.b2 = 0x78;   // No second source register
+		O3 = 0xCC;
 		O2 = 0xCC;
 		O1 = 0xCC;
 		modRM.b = 0xCC;
@@ -250,6 +262,31 @@ namespace SoftWire
 		return format.I1 || format.I2 || format.I3 || format.I4;
 	}
 
+	int Encoding::displacementSize() const
+	{
+		return format.D1 + format.D2 + format.D3 + format.D4;
+	}
+
+	int Encoding::immediateSize() const
+	{
+		return format.I1 + format.I2 + format.I3 + format.I4;
+	}
+
+	int Encoding::getAlignment() const
+	{
+		if(P1 == 0xF1 && O1 == 0x90)
+		{
+			return immediate;
+		}
+
+		return 0;
+	}
+
+	bool Encoding::isData() const
+	{
+		return P1 == 0xF1;
+	}
+
 	void Encoding::setAddress(const unsigned char *address)
 	{
 		this->address = address;
@@ -326,6 +363,8 @@ namespace SoftWire
 			if(format.P2)		OUTPUT_BYTE(P2);
 			if(format.P3)		OUTPUT_BYTE(P3);
 			if(format.P4)		OUTPUT_BYTE(P4);
+			if(format.VEX)		{OUTPUT_BYTE(0xC4); OUTPUT_BYTE(VEX.b1); OUTPUT_BYTE(VEX.b2);}
+			if(format.O3)		OUTPUT_BYTE(O3);
 			if(format.O2)		OUTPUT_BYTE(O2);
 			if(format.O1)		OUTPUT_BYTE(O1);
 			if(format.modRM)	OUTPUT_BYTE(modRM.b);
@@ -377,6 +416,8 @@ namespace SoftWire
 		if(format.P2)		{sprintf(buffer, "%.2X ", P2);		buffer += 3;}
 		if(format.P3)		{sprintf(buffer, "%.2X ", P3);		buffer += 3;}
 		if(format.P4)		{sprintf(buffer, "%.2X ", P4);		buffer += 3;}
+		if(format.VEX)		{sprintf(buffer, "C4 %.2X %.2X ", VEX.b1, VEX.b2);	buffer += 9;}
+		if(format.O3)		{sprintf(buffer, "%.2X ", O3);		buffer += 3;}
 		if(format.O2)		{sprintf(buffer, "%.2X ", O2);		buffer += 3;}
 		if(format.O1)		{sprintf(buffer, "%.2X ", O1);		buffer += 3;}
 		if(format.modRM)	{sprintf(buffer, "%.2X ", modRM.b);	buffer += 3;}
@@ -394,4 +435,92 @@ namespace SoftWire
 
 		return buffer - start;
 	}
+
+	bool Encoding::write(FILE *file) const
+	{
+		int flags = 0;
+
+		if(format.P1)		flags |= 0x00001;
+		if(format.P2)		flags |= 0x00002;
+		if(format.P3)		flags |= 0x00004;
+		if(format.P4)		flags |= 0x00008;
+		if(format.VEX)		flags |= 0x00010;
+		if(format.O3)		flags |= 0x00020;
+		if(format.O2)		flags |= 0x00040;
+		if(format.O1)		flags |= 0x00080;
+		if(format.modRM)	flags |= 0x00100;
+		if(format.SIB)		flags |= 0x00200;
+		if(format.D1)		flags |= 0x00400;
+		if(format.D2)		flags |= 0x00800;
+		if(format.D3)		flags |= 0x01000;
+		if(format.D4)		flags |= 0x02000;
+		if(format.I1)		flags |= 0x04000;
+		if(format.I2)		flags |= 0x08000;
+		if(format.I3)		flags |= 0x10000;
+		if(format.I4)		flags |= 0x20000;
+		if(relative)		flags |= 0x40000;
+
+		const unsigned char bytes[11] = {P1, P2, P3, P4, VEX.b1, VEX.b2, O3, O2, O1, modRM.b, SIB.b};
+		const int fields[3] = {flags, displacement, immediate};
+
+		return fwrite(fields, sizeof(int), 3, file) == 3 &&
+		       fwrite(bytes, 1, 11, file) == 11 &&
+		       writeString(file, label) &&
+		       writeString(file, reference);
+	}
+
+	bool Encoding::read(FILE *file)
+	{
+		reset();
+
+		unsigned char bytes[11];
+		int fields[3];
+
+		if(fread(fields, sizeof(int), 3, file) != 3 ||
+		   fread(bytes, 1, 11, file) != 11 ||
+		   !readString(file, label) ||
+		   !readString(file, reference))
+		{
+			return false;
+		}
+
+		const int flags = fields[0];
+
+		format.P1 =		(flags & 0x00001) != 0;
+		format.P2 =		(flags & 0x00002) != 0;
+		format.P3 =		(flags & 0x00004) != 0;
+		format.P4 =		(flags & 0x00008) != 0;
+		format.VEX =	(flags & 0x00010) != 0;
+		format.O3 =		(flags & 0x00020) != 0;
+		format.O2 =		(flags & 0x00040) != 0;
+		format.O1 =		(flags & 0x00080) != 0;
+		format.modRM =	(flags & 0x00100) != 0;
+		format.SIB =	(flags & 0x00200) != 0;
+		format.D1 =		(flags & 0x00400) != 0;
+		format.D2 =		(flags & 0x00800) != 0;
+		format.D3 =		(flags & 0x01000) != 0;
+		format.D4 =		(flags & 0x02000) != 0;
+		format.I1 =		(flags & 0x04000) != 0;
+		format.I2 =		(flags & 0x08000) != 0;
+		format.I3 =		(flags & 0x10000) != 0;
+		format.I4 =		(flags & 0x20000) != 0;
+		relative =		(flags & 0x40000) != 0;
+
+		displacement = fields[1];
+		immediate = fields[2];
+
+		P1 = bytes[0];
+		P2 = bytes[1];
+		P3 = bytes[2];
+		P4 = bytes[3];
+		VEX.b1 = bytes[4];
+		VEX.b2 = bytes[5];
+		O3 = bytes[6];
+		O2 = bytes[7];
+		O1 = bytes[8];
+		modRM.b = bytes[9];
+		SIB.b = bytes[10];
+
+		return true;
+	}
 }
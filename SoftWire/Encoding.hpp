@@ -1,6 +1,8 @@
 #ifndef SoftWire_Encoding_hpp
 #define SoftWire_Encoding_hpp
 
+#include <stdio.h>
+
 namespace SoftWire
 {
 	class Synthesizer;
@@ -55,12 +57,20 @@ namespace SoftWire
 		bool absoluteReference() const;
 		bool hasDisplacement() const;
 		bool hasImmediate() const;
+		int displacementSize() const;
+		int immediateSize() const;
+		int getAlignment() const;   // Of ALIGN directives, 0 otherwise
+		bool isData() const;
 
 		void setAddress(const unsigned char *address);
 		const unsigned char *getAddress() const;
 
 		int printCode(char *buffer) const;
 
+		// Precompiled records, references are kept symbolic
+		bool write(FILE *file) const;
+		bool read(FILE *file);
+
 	private:
 		enum Mod
 		{
@@ -93,6 +103,8 @@ namespace SoftWire
 			bool P2 : 1;
 			bool P3 : 1;
 			bool P4 : 1;
+			bool VEX : 1;
+			bool O3 : 1;
 			bool O2 : 1;
 			bool O1 : 1;
 			bool modRM : 1;
@@ -111,8 +123,37 @@ namespace SoftWire
 		unsigned char P2;
 		unsigned char P3;
 		unsigned char P4;
+		struct
+		{
+			union
+			{
+				struct
+				{
+					unsigned char mmmmm : 5;   // Opcode map
+					unsigned char B : 1;
+					unsigned char X : 1;
+					unsigned char R : 1;
+				};
+
+				unsigned char b1;
+			};
+
+			union
+			{
+				struct
+				{
+					unsigned char pp : 2;   // Implied prefix
+					unsigned char L : 1;
+					unsigned char vvvv : 4;   // Inverted register specifier
+					unsigned char W : 1;
+				};
+
+				unsigned char b2;
+			};
+		} VEX;
 		unsigned char O1;   // Opcode
 		unsigned char O2;
+		unsigned char O3;
 		struct
 		{
 			union
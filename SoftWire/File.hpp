@@ -2,6 +2,7 @@
 #define SoftWire_File_hpp
 
 #include "Error.hpp"
+#include "String.hpp"
 
 #include <stdio.h>
 #include <io.h>
@@ -25,6 +26,39 @@ namespace SoftWire
 		return statbuf.st_size;
 	}
 #endif
+
+	// Length prefixed, distinguishes null from empty strings
+	inline bool writeString(FILE *file, const char *string)
+	{
+		const int length = string ? strlen(string) : -1;
+
+		if(fwrite(&length, sizeof(int), 1, file) != 1)
+		{
+			return false;
+		}
+
+		return length <= 0 || fwrite(string, 1, length, file) == (size_t)length;
+	}
+
+	inline bool readString(FILE *file, char *&string)
+	{
+		int length;
+
+		if(fread(&length, sizeof(int), 1, file) != 1 || length < -1 || length > 0xFFFF)
+		{
+			return false;
+		}
+
+		if(length == -1)
+		{
+			return true;
+		}
+
+		string = new char[length + 1];
+		string[length] = '\0';
+
+		return fread(string, 1, length, file) == (size_t)length;
+	}
 }
 
 #endif   // SoftWire_File_hpp
@@ -192,23 +192,23 @@ namespace SoftWire
 		{
 			if(specifier != Specifier::UNKNOWN)
 			{
-				if(firstOperand == Operand::R_M8 || secondOperand == Operand::R_M8)
+				if(firstOperand == Operand::R_M8 || secondOperand == Operand::R_M8 || thirdOperand == Operand::R_M8)
 				{
 					syntaxMatch = specifier == Specifier::BYTE;
 				}
-				else if(firstOperand == Operand::R_M16 || secondOperand == Operand::R_M16)
+				else if(firstOperand == Operand::R_M16 || secondOperand == Operand::R_M16 || thirdOperand == Operand::R_M16)
 				{
 					syntaxMatch = specifier == Specifier::WORD;
 				}
-				else if(firstOperand == Operand::R_M32 || secondOperand == Operand::R_M32)
+				else if(firstOperand == Operand::R_M32 || secondOperand == Operand::R_M32 || thirdOperand == Operand::R_M32)
 				{
 					syntaxMatch = specifier == Specifier::DWORD;
 				}
-				else if(firstOperand == Operand::R_M64 || secondOperand == Operand::R_M64)
+				else if(firstOperand == Operand::R_M64 || secondOperand == Operand::R_M64 || thirdOperand == Operand::R_M64)
 				{
 					syntaxMatch = (specifier == Specifier::QWORD || specifier == Specifier::MMWORD);
 				}
-				else if(firstOperand == Operand::R_M128 || secondOperand == Operand::R_M128)
+				else if(firstOperand == Operand::R_M128 || secondOperand == Operand::R_M128 || thirdOperand == Operand::R_M128)
 				{
 					syntaxMatch = specifier == Specifier::XMMWORD;
 				}
@@ -324,6 +324,10 @@ namespace SoftWire
 		{
 			syntaxMatch = true;
 		}
+		else if(operand.type == Operand::MEM && thirdOperand & Operand::MEM)   // Implicit size specifier
+		{
+			syntaxMatch = true;
+		}
 		else
 		{
 			syntaxMatch = false;
@@ -360,6 +364,11 @@ namespace SoftWire
 		return syntax.encoding;
 	}
 
+	int Instruction::getFlags() const
+	{
+		return flags;
+	}
+
 	bool Instruction::is32Bit() const
 	{
 		return (flags & CPU_386) == CPU_386;
@@ -375,6 +384,8 @@ namespace SoftWire
 		}
 
 		int size = 0;
+		bool vex = false;   // Prefixes and opcode map are part of the VEX prefix
+		int vexEscape = 0;
 
 		while(*format)
 		{
@@ -384,7 +395,10 @@ namespace SoftWire
 			case CONST_PRE:
 			case REPNE_PRE:
 			case REP_PRE:
-				size += 1;
+				if(!vex)
+				{
+					size += 1;
+				}
 				break;
 			case OFF_PRE:
 				if(!is32Bit())
@@ -400,6 +414,13 @@ namespace SoftWire
 				break;
 			case ADD_REG:
 				break;
+			case VEX_0:
+			case VEX_1:
+			case VEX_2:
+			case VEX_3:
+				size += 3;
+				vex = true;
+				break;
 			case EFF_ADDR:
 			case MOD_RM_0:
 			case MOD_RM_1:
@@ -423,7 +444,28 @@ namespace SoftWire
 				size += 1;
 				break;
 			default:
-				size += 1;
+				if(!vex)
+				{
+					size += 1;
+				}
+				else   // Same map parsing as Synthesizer::encodeVexOpcode
+				{
+					const unsigned int opcode = strtoul(format, 0, 16);
+
+					if(vexEscape == 0 && opcode == 0x0F)
+					{
+						vexEscape = 1;
+					}
+					else if(vexEscape == 1 && (opcode == 0x38 || opcode == 0x3A))
+					{
+						vexEscape = 2;
+					}
+					else if(vexEscape != 0 || opcode != 0x66)   // Not the implied operand size prefix
+					{
+						size += 1;
+						vexEscape = 3;   // Following bytes are plain opcode bytes
+					}
+				}
 			}
 
 			format += 2;
@@ -21,6 +21,7 @@ namespace SoftWire
 			p3 REP/REPE/REPZ instruction prefix (F3h) (also SSE prefix)
 			po Offset override prefix (66h)
 			pa Address override prefix (67h) 
+			v# VEX prefix, NDS register from operand # (v0 when unused)
 		*/
 
 		ADD_REG		= ('+' << 8) | 'r',
@@ -43,7 +44,11 @@ namespace SoftWire
 		REPNE_PRE	= ('p' << 8) | '2',
 		REP_PRE		= ('p' << 8) | '3',
 		OFF_PRE		= ('p' << 8) | 'o',
-		ADDR_PRE	= ('p' << 8) | 'a'
+		ADDR_PRE	= ('p' << 8) | 'a',
+		VEX_0		= ('v' << 8) | '0',
+		VEX_1		= ('v' << 8) | '1',
+		VEX_2		= ('v' << 8) | '2',
+		VEX_3		= ('v' << 8) | '3'
 	};
 
 	class Instruction
@@ -78,7 +83,14 @@ namespace SoftWire
 			CPU_SMM			= 0x00020000,   // System Management Mode, standby mode
 
 			CPU_UNDOC		= 0x00040000,   // Undocumented, also not supported by Visual Studio inline assembler
-			CPU_PRIV		= 0x00080000    // Priviledged, run-time compiled OS kernel anyone?
+			CPU_PRIV		= 0x00080000,   // Priviledged, run-time compiled OS kernel anyone?
+
+			CPU_LZCNT		= 0x00100000 | CPU_P6,
+			CPU_POPCNT		= 0x00200000 | CPU_P6,
+			CPU_BMI1		= 0x00400000 | CPU_P6,   // VEX encoded general purpose instructions
+			CPU_BMI2		= 0x00800000 | CPU_P6,
+			CPU_ADX			= 0x01000000 | CPU_P6,
+			CPU_XSAVE		= 0x02000000 | CPU_P6   // XGETBV, needs the OS to enable it
 		};
 
 		struct Syntax
@@ -113,6 +125,7 @@ namespace SoftWire
 		const char *getMnemonic() const;
 		const char *getOperandSyntax() const;
 		const char *getEncoding() const;
+		int getFlags() const;
 		
 		bool is32Bit() const;
 
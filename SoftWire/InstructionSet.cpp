@@ -5,11 +5,16 @@
 #include "Scanner.hpp"
 #include "Token.hpp"
 #include "Operand.hpp"
+#include "Encoding.hpp"
+#include "CPUID.hpp"
 
 #include <stdlib.h>
+#include <string.h>
 
 namespace SoftWire
 {
+	bool InstructionSet::targetEnforced = false;
+
 	InstructionSet::InstructionSet()
 	{
 		Instruction **instructionList = new Instruction*[numInstructions()];
@@ -48,6 +53,8 @@ namespace SoftWire
 			throw INTERNAL_ERROR;
 		}
 
+		classifyIntrinsics();
+
 	//	generateIntrinsics();   // Uncomment this line when you make changes to the instruction set
 	}
 
@@ -55,6 +62,8 @@ namespace SoftWire
 	{
 		delete[] instructionMap;
 		delete[] intrinsicMap;
+		delete[] semanticsMap;
+		delete[] implicitMap;
 	}
 
 	const Instruction *InstructionSet::instruction(int i)
@@ -81,6 +90,241 @@ namespace SoftWire
 		return query->instruction;
 	}
 
+	int InstructionSet::semantics(int i) const
+	{
+		return semanticsMap[i];
+	}
+
+	unsigned int InstructionSet::implicitRegisters(int i) const
+	{
+		return implicitMap[i];
+	}
+
+	void InstructionSet::enforceTarget(bool enforce)
+	{
+		targetEnforced = enforce;
+	}
+
+	bool InstructionSet::isTargetEnforced()
+	{
+		return targetEnforced;
+	}
+
+	bool InstructionSet::supported(const Instruction *instruction)
+	{
+		if(!targetEnforced)
+		{
+			return true;
+		}
+
+		return (instruction->getFlags() & ~CPUID::instructionFlags()) == 0;
+	}
+
+	void InstructionSet::classifyIntrinsics()
+	{
+		semanticsMap = new int[numInstructions()];
+		implicitMap = new unsigned int[numInstructions()];
+
+		for(int i = 0; i < numInstructions(); i++)
+		{
+			const Instruction *instruction = intrinsicMap[i];
+
+			semanticsMap[i] = classify(instruction->getMnemonic(), implicitMap[i]);
+
+			const Operand::Type type[3] = {instruction->getFirstOperand(), instruction->getSecondOperand(), instruction->getThirdOperand()};
+
+			if(!Operand::isSubtypeOf(Operand::MMREG, type[0]) && !Operand::isSubtypeOf(Operand::MMREG, type[1]) && !Operand::isSubtypeOf(Operand::MMREG, type[2]))
+			{
+				continue;
+			}
+
+			// Same mnemonic with XMM registers in place of the MMX ones
+			const Entry *entry = (const Entry*)bsearch(instruction->getMnemonic(), instructionMap, numMnemonics(), sizeof(Entry), compareEntry);
+
+			for(const Instruction *candidate = entry ? entry->instruction : 0; candidate; candidate = candidate->getNext())
+			{
+				const Operand::Type other[3] = {candidate->getFirstOperand(), candidate->getSecondOperand(), candidate->getThirdOperand()};
+				bool equivalent = false;
+
+				for(int j = 0; j < 3; j++)
+				{
+					if(Operand::isSubtypeOf(Operand::MMREG, type[j]))
+					{
+						equivalent = Operand::isSubtypeOf(Operand::XMMREG, other[j]);
+
+						if(!equivalent) break;
+					}
+				}
+
+				if(equivalent)
+				{
+					semanticsMap[i] |= SSE2_EQUIVALENT;
+					break;
+				}
+			}
+		}
+	}
+
+	int InstructionSet::classify(const char *mnemonic, unsigned int &implicit)
+	{
+		static const char *readOnly[] =
+		{
+			"BOUND", "BT", "CALL", "CMP", "COMISD", "COMISS", "JMP", "LLDT", "LMSW", "LTR",
+			"MASKMOVDQU", "MASKMOVQ", "OUT", "PUSH", "TEST", "UCOMISD", "UCOMISS", "VERR", "VERW"
+		};
+
+		// Including stores larger than their operand's declared type
+		static const char *barrier[] =
+		{
+			"CALL", "CMPXCHG8B", "ENTER", "FNSAVE", "FNSTENV", "FSAVE", "FSTENV", "INT", "INT3", "INTO", "LEAVE",
+			"LOCK CMPXCHG8B", "MASKMOVDQU", "MASKMOVQ"
+		};
+
+		static const char *overwrite[] =
+		{
+			"CVTDQ2PD", "CVTDQ2PS", "CVTPD2DQ", "CVTPD2PI", "CVTPD2PS", "CVTPS2DQ", "CVTPS2PD", "CVTPS2PI",
+			"CVTSD2SI", "CVTSS2SI", "CVTTPD2DQ", "CVTTPD2PI", "CVTTPS2DQ", "CVTTPS2PI", "CVTTSD2SI", "CVTTSS2SI",
+			"LDDQU", "LEA", "MOV", "MOVAPD", "MOVAPS", "MOVD", "MOVDDUP", "MOVDQA", "MOVDQU", "MOVMSKPD", "MOVMSKPS",
+			"MOVQ", "MOVSHDUP", "MOVSLDUP", "MOVSX", "MOVUPD", "MOVUPS", "MOVZX", "PEXTRW", "PMOVMSKB", "POP",
+			"PSHUFD", "PSHUFHW", "PSHUFLW", "PSHUFW", "RCPPS", "RSQRTPS", "SQRTPD", "SQRTPS"
+		};
+
+		static const char *zeroIdiom[] =
+		{
+			"PCMPEQB", "PCMPEQD", "PCMPEQW", "PSUBB", "PSUBD", "PSUBQ", "PSUBW", "PXOR", "SUB", "XOR", "XORPD", "XORPS"
+		};
+
+		static const char *move128[] = {"MOVAPD", "MOVAPS", "MOVDQA", "MOVDQU", "MOVUPD", "MOVUPS"};
+
+		static const char *stack[] =
+		{
+			"POP", "POPA", "POPAD", "POPAW", "POPF", "POPFD", "POPFW",
+			"PUSH", "PUSHA", "PUSHAD", "PUSHAW", "PUSHF", "PUSHFD", "PUSHFW", "RET", "RETF", "RETN"
+		};
+
+		// MOVSD and CMPSD also name SSE2 instructions, those have operands
+		static const char *stringStore[] = {"INSB", "INSD", "INSW", "MOVSB", "MOVSD", "MOVSW", "STOSB", "STOSD", "STOSW"};
+		static const char *stringRead[] = {"CMPSB", "CMPSD", "CMPSW", "LODSB", "LODSD", "LODSW", "SCASB", "SCASD", "SCASW"};
+
+		static const struct
+		{
+			const char *mnemonic;
+			unsigned int registers;
+		}
+		implicitTable[] =
+		{
+			{"AAA",			1 << Encoding::EAX},
+			{"AAD",			1 << Encoding::EAX},
+			{"AAM",			1 << Encoding::EAX},
+			{"AAS",			1 << Encoding::EAX},
+			{"CBW",			1 << Encoding::EAX},
+			{"CDQ",			1 << Encoding::EDX},
+			{"CMPXCHG",		1 << Encoding::EAX},
+			{"CMPXCHG486",	1 << Encoding::EAX},
+			{"CMPXCHG8B",	1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"CPUID",		1 << Encoding::EAX | 1 << Encoding::ECX | 1 << Encoding::EDX | 1 << Encoding::EBX},
+			{"CWD",			1 << Encoding::EDX},
+			{"CWDE",		1 << Encoding::EAX},
+			{"DAA",			1 << Encoding::EAX},
+			{"DAS",			1 << Encoding::EAX},
+			{"DIV",			1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"IDIV",		1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"LAHF",		1 << Encoding::EAX},
+			{"LOOP",		1 << Encoding::ECX},
+			{"LOOPE",		1 << Encoding::ECX},
+			{"LOOPNE",		1 << Encoding::ECX},
+			{"LOOPNZ",		1 << Encoding::ECX},
+			{"LOOPZ",		1 << Encoding::ECX},
+			{"MUL",			1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"POPA",		0xFF},
+			{"POPAD",		0xFF},
+			{"POPAW",		0xFF},
+			{"RDMSR",		1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"RDPMC",		1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"RDTSC",		1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"SALC",		1 << Encoding::EAX},
+			{"XGETBV",		1 << Encoding::EAX | 1 << Encoding::EDX},
+			{"XLATB",		1 << Encoding::EAX}
+		};
+
+		int semantics = 0;
+		implicit = 0;
+
+		const bool locked = strncmp(mnemonic, "LOCK ", 5) == 0;
+		const char *operation = locked ? mnemonic + 5 : mnemonic;
+
+		for(unsigned int i = 0; i < sizeof(readOnly) / sizeof(readOnly[0]); i++)
+		{
+			if(strcmp(operation, readOnly[i]) == 0) semantics |= READS_FIRST;
+		}
+
+		for(unsigned int i = 0; i < sizeof(barrier) / sizeof(barrier[0]); i++)
+		{
+			if(strcmp(mnemonic, barrier[i]) == 0) semantics |= BARRIER;
+		}
+
+		for(unsigned int i = 0; i < sizeof(overwrite) / sizeof(overwrite[0]); i++)
+		{
+			if(strcmp(mnemonic, overwrite[i]) == 0) semantics |= OVERWRITE;
+		}
+
+		for(unsigned int i = 0; i < sizeof(zeroIdiom) / sizeof(zeroIdiom[0]); i++)
+		{
+			if(strcmp(mnemonic, zeroIdiom[i]) == 0) semantics |= ZERO_IDIOM;
+		}
+
+		for(unsigned int i = 0; i < sizeof(move128) / sizeof(move128[0]); i++)
+		{
+			if(strcmp(mnemonic, move128[i]) == 0) semantics |= MOVE128;
+		}
+
+		for(unsigned int i = 0; i < sizeof(implicitTable) / sizeof(implicitTable[0]); i++)
+		{
+			if(strcmp(operation, implicitTable[i].mnemonic) == 0) implicit = implicitTable[i].registers;
+		}
+
+		for(unsigned int i = 0; i < sizeof(stack) / sizeof(stack[0]); i++)
+		{
+			if(strcmp(mnemonic, stack[i]) == 0) semantics |= BARRIER;
+		}
+
+		for(unsigned int i = 0; i < sizeof(stringStore) / sizeof(stringStore[0]); i++)
+		{
+			if(strcmp(operation, stringStore[i]) == 0) semantics |= locked ? STRING : STRING | STRING_STORE;
+		}
+
+		for(unsigned int i = 0; i < sizeof(stringRead) / sizeof(stringRead[0]); i++)
+		{
+			if(strcmp(operation, stringRead[i]) == 0) semantics |= STRING;
+		}
+
+		if(strchr(operation, ' '))   // Repeated string instructions
+		{
+			semantics |= locked ? STRING : STRING | BARRIER;
+		}
+
+		if(strcmp(operation, "XCHG") == 0 || strcmp(operation, "XADD") == 0 || strcmp(operation, "MULX") == 0) semantics |= WRITES_SECOND;
+		if(strcmp(mnemonic, "MOV") == 0) semantics |= MOVE32;
+		if(strcmp(mnemonic, "MOVQ") == 0) semantics |= MOVE64;
+		if(strcmp(mnemonic, "MOVSS") == 0 || strcmp(mnemonic, "MOVSD") == 0) semantics |= SCALAR_MOVE;
+		if(strcmp(operation, "IMUL") == 0) semantics |= MULTIPLY;
+		if(strcmp(mnemonic, "CALL") == 0) semantics |= CALL;
+		if(strcmp(mnemonic, "JMP") == 0) semantics |= JUMP;
+		if(strncmp(mnemonic, "RET", 3) == 0) semantics |= RETURN;
+		if(mnemonic[0] == 'J' || strncmp(mnemonic, "LOOP", 4) == 0) semantics |= BRANCH;
+		if(strncmp(mnemonic, "BT", 2) == 0) semantics |= BIT_TEST;
+		if(mnemonic[0] == 'F') semantics |= X87;
+		if(strcmp(mnemonic, "EMMS") == 0 || strcmp(mnemonic, "FEMMS") == 0) semantics |= EMPTIES_MMX;
+
+		// x87 instructions, saving the state is fine either way
+		if((semantics & (CALL | RETURN)) || ((semantics & X87) && !(semantics & EMPTIES_MMX) && strcmp(mnemonic, "FXSAVE") != 0 && strcmp(mnemonic, "FXRSTOR") != 0))
+		{
+			semantics |= NEEDS_EMPTY_MMX;
+		}
+
+		return semantics;
+	}
+
 	int InstructionSet::compareSyntax(const void *element1, const void *element2)
 	{
 		return stricmp((*(Instruction**)element1)->getMnemonic(), (*(Instruction**)element2)->getMnemonic());
@@ -109,6 +353,7 @@ namespace SoftWire
 			p3 REP/REPE/REPZ instruction prefix (F3h) (also SSE prefix)
 			po Offset override prefix (66h)
 			pa Address override prefix (67h)
+			v# VEX prefix, NDS register from operand # (v0 when unused)
 
 			Read Keywords.cpp for operands syntax
 		*/
@@ -142,6 +387,7 @@ namespace SoftWire
 		{"ADC",				"AL,imm8",					"14 ib",				Instruction::CPU_8086},
 		{"ADC",				"AX,imm16",					"po 15 iw",				Instruction::CPU_8086},
 		{"ADC",				"EAX,imm32",				"po 15 id",				Instruction::CPU_386},
+		{"ADCX",			"reg32,r/m32",				"66 0F 38 F6 /r",		Instruction::CPU_ADX},
 		{"ADD",				"r/m8,reg8",				"00 /r",				Instruction::CPU_8086},
 		{"ADD",				"r/m16,reg16",				"po 01 /r",				Instruction::CPU_8086},
 		{"ADD",				"r/m32,reg32",				"po 01 /r",				Instruction::CPU_386},
@@ -168,6 +414,7 @@ namespace SoftWire
 		{"ADDPS",			"xmmreg,r/m128",			"0F 58 /r",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
 		{"ADDSD",			"xmmreg,xmm64",				"p2 0F 58 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"ADDSS",			"xmmreg,xmm32",				"p3 0F 58 /r",			Instruction::CPU_KATMAI | Instruction::CPU_SSE},
+		{"ADOX",			"reg32,r/m32",				"p3 0F 38 F6 /r",		Instruction::CPU_ADX},
 		{"AND",				"r/m8,reg8",				"20 /r",				Instruction::CPU_8086},
 		{"AND",				"r/m16,reg16",				"po 21 /r",				Instruction::CPU_8086},
 		{"AND",				"r/m32,reg32",				"po 21 /r",				Instruction::CPU_386},
@@ -190,10 +437,15 @@ namespace SoftWire
 		{"AND",				"AL,imm8",					"24 ib",				Instruction::CPU_8086},
 		{"AND",				"AX,imm16",					"po 25 iw",				Instruction::CPU_8086},
 		{"AND",				"EAX,imm32",				"po 25 id",				Instruction::CPU_386},
+		{"ANDN",			"reg32,reg32,r/m32",		"v2 0F 38 F2 /r",		Instruction::CPU_BMI1},
 		{"ANDNPD",			"xmmreg,r/m128",			"66 0F 55 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"ANDNPS",			"xmmreg,r/m128",			"0F 55 /r",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
 		{"ANDPD",			"xmmreg,r/m128",			"66 0F 54 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"ANDPS",			"xmmreg,r/m128",			"0F 54 /r",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
+		{"BEXTR",			"reg32,r/m32,reg32",		"v3 0F 38 F7 /r",		Instruction::CPU_BMI1},
+		{"BLSI",			"reg32,r/m32",				"v1 0F 38 F3 /3",		Instruction::CPU_BMI1},
+		{"BLSMSK",			"reg32,r/m32",				"v1 0F 38 F3 /2",		Instruction::CPU_BMI1},
+		{"BLSR",			"reg32,r/m32",				"v1 0F 38 F3 /1",		Instruction::CPU_BMI1},
 	//	{"ARPL",			"r/m16,reg16",				"63 /r",				Instruction::CPU_286 | Instruction::CPU_PRIV},
 		{"BOUND",			"reg16,mem",				"po 62 /r",				Instruction::CPU_186},
 		{"BOUND",			"reg32,mem",				"po 62 /r",				Instruction::CPU_386},
@@ -218,6 +470,7 @@ namespace SoftWire
 		{"BTS",				"r/m32,reg32",				"po 0F AB /r",			Instruction::CPU_386},
 		{"BTS",				"r/m16,imm",				"po 0F BA /5 ib",		Instruction::CPU_386},
 		{"BTS",				"r/m32,imm",				"po 0F BA /5 ib",		Instruction::CPU_386},
+		{"BZHI",			"reg32,r/m32,reg32",		"v3 0F 38 F5 /r",		Instruction::CPU_BMI2},
 		{"LOCK BTC",		"mem16,reg16",				"p0 po 0F BB /r",		Instruction::CPU_386},
 		{"LOCK BTC",		"mem32,reg32",				"p0 po 0F BB /r",		Instruction::CPU_386},
 		{"LOCK BTC",		"mem16,imm8",				"p0 po 0F BA /7 ib",	Instruction::CPU_386},
@@ -785,6 +1038,7 @@ namespace SoftWire
 	//	{"LSL",				"reg16,r/m16",				"po 0F 03 /r",			Instruction::CPU_286 | Instruction::CPU_PRIV},
 	//	{"LSL",				"reg32,r/m32",				"po 0F 03 /r",			Instruction::CPU_286 | Instruction::CPU_PRIV},
 	//	{"LTR",				"r/m16",					"0F 00 /3",				Instruction::CPU_286 | Instruction::CPU_PRIV},
+		{"LZCNT",			"reg32,r/m32",				"p3 0F BD /r",			Instruction::CPU_LZCNT},
 		{"MASKMOVDQU",		"xmmreg,xmmreg",			"66 0F F7 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"MASKMOVQ",		"mmreg,mmreg",				"0F F7 /r",				Instruction::CPU_KATMAI},
 		{"MAXPD",			"xmmreg,r/m128",			"66 0F 5F /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
@@ -888,6 +1142,7 @@ namespace SoftWire
 		{"MULPS",			"xmmreg,r/m128",			"0F 59 /r",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
 		{"MULSD",			"xmmreg,xmm64",				"p2 0F 59 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"MULSS",			"xmmreg,xmm32",				"p3 0F 59 /r",			Instruction::CPU_KATMAI | Instruction::CPU_SSE},
+		{"MULX",			"reg32,reg32,r/m32",		"v2 p2 0F 38 F6 /r",	Instruction::CPU_BMI2},
 		{"NEG",				"BYTE r/m8",				"F6 /3",				Instruction::CPU_8086},
 		{"NEG",				"WORD r/m16",				"po F7 /3",				Instruction::CPU_8086},
 		{"NEG",				"DWORD r/m32",				"po F7 /3",				Instruction::CPU_386},
@@ -983,6 +1238,8 @@ namespace SoftWire
 		{"PCMPGTB",			"xmmreg,r/m128",			"66 0F 64 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"PCMPGTW",			"xmmreg,r/m128",			"66 0F 65 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"PCMPGTD",			"xmmreg,r/m128",			"66 0F 66 /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2},
+		{"PDEP",			"reg32,reg32,r/m32",		"v2 p2 0F 38 F5 /r",	Instruction::CPU_BMI2},
+		{"PEXT",			"reg32,reg32,r/m32",		"v2 p3 0F 38 F5 /r",	Instruction::CPU_BMI2},
 		{"PDISTIB",			"mmreg,mem64",				"0F 54 /r",				Instruction::CPU_CYRIX | Instruction::CPU_MMX},
 		{"PEXTRW",			"reg32,mmreg,imm8",			"0F C5 /r ib",			Instruction::CPU_KATMAI},
 		{"PEXTRW",			"reg32,xmmreg,imm8",		"66 0F C5 /r ib",		Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
@@ -1051,6 +1308,7 @@ namespace SoftWire
 		{"POPA",			"",							"61",					Instruction::CPU_186},
 		{"POPAW",			"",							"po 61",				Instruction::CPU_186},
 		{"POPAD",			"",							"po 61",				Instruction::CPU_386},
+		{"POPCNT",			"reg32,r/m32",				"p3 0F B8 /r",			Instruction::CPU_POPCNT},
 		{"POPF",			"",							"9D",					Instruction::CPU_186},
 		{"POPFW",			"",							"po 9D",				Instruction::CPU_186},
 		{"POPFD",			"",							"po 9D",				Instruction::CPU_386},
@@ -1202,6 +1460,7 @@ namespace SoftWire
 		{"ROR",				"r/m32,1",					"po D1 /1",				Instruction::CPU_386},
 		{"ROR",				"r/m32,CL",					"po D3 /1",				Instruction::CPU_386},
 		{"ROR",				"r/m32,imm8",				"po C1 /1 ib",			Instruction::CPU_386},
+		{"RORX",			"reg32,r/m32,imm8",			"v0 p2 0F 3A F0 /r ib",	Instruction::CPU_BMI2},
 	//	{"RSDC",			"segreg,mem80",				"0F 79 /r",				Instruction::CPU_486 | Instruction::CPU_CYRIX | Instruction::CPU_SMM},
 	//	{"RSLDT",			"mem80",					"0F 7B /0",				Instruction::CPU_486 | Instruction::CPU_CYRIX | Instruction::CPU_SMM},
 		{"RSM",				"",							"0F AA",				Instruction::CPU_PENTIUM},
@@ -1227,6 +1486,7 @@ namespace SoftWire
 		{"SAR",				"r/m32,1",					"po D1 /7",				Instruction::CPU_386},
 		{"SAR",				"r/m32,CL",					"po D3 /7",				Instruction::CPU_386},
 		{"SAR",				"r/m32,imm8",				"po C1 /7 ib",			Instruction::CPU_386},
+		{"SARX",			"reg32,r/m32,reg32",		"v3 p3 0F 38 F7 /r",	Instruction::CPU_BMI2},
 	//	{"SALC",			"",							"D6",					Instruction::CPU_8086 | Instruction::CPU_UNDOC},
 		{"SBB",				"r/m8,reg8",				"18 /r",				Instruction::CPU_8086},
 		{"SBB",				"r/m16,reg16",				"po 19 /r",				Instruction::CPU_8086},
@@ -1311,6 +1571,7 @@ namespace SoftWire
 		{"SHL",				"DWORD r/m32,1",			"po D1 /4",				Instruction::CPU_386},
 		{"SHL",				"DWORD r/m32,CL",			"po D3 /4",				Instruction::CPU_386},
 		{"SHL",				"DWORD r/m32,imm8",			"po C1 /4 ib",			Instruction::CPU_386},
+		{"SHLX",			"reg32,r/m32,reg32",		"v3 66 0F 38 F7 /r",	Instruction::CPU_BMI2},
 		{"SHR",				"BYTE r/m8,1",				"D0 /5",				Instruction::CPU_8086},
 		{"SHR",				"BYTE r/m8,CL",				"D2 /5",				Instruction::CPU_8086},
 		{"SHR",				"BYTE r/m8,imm8",			"C0 /5 ib",				Instruction::CPU_286},
@@ -1320,6 +1581,7 @@ namespace SoftWire
 		{"SHR",				"DWORD r/m32,1",			"po D1 /5",				Instruction::CPU_386},
 		{"SHR",				"DWORD r/m32,CL",			"po D3 /5",				Instruction::CPU_386},
 		{"SHR",				"DWORD r/m32,imm8",			"po C1 /5 ib",			Instruction::CPU_386},
+		{"SHRX",			"reg32,r/m32,reg32",		"v3 p2 0F 38 F7 /r",	Instruction::CPU_BMI2},
 		{"SHLD",			"WORD r/m16,reg16,imm8",	"po 0F A4 /r ib",		Instruction::CPU_386},
 		{"SHLD",			"DWORD r/m32,reg32,imm8",	"po 0F A4 /r ib",		Instruction::CPU_386},
 		{"SHLD",			"WORD r/m16,reg16,CL",		"po 0F A5 /r",			Instruction::CPU_386},
@@ -1391,6 +1653,7 @@ namespace SoftWire
 		{"TEST",			"AL,imm8",					"A8 ib",				Instruction::CPU_8086},
 		{"TEST",			"AX,imm16",					"po A9 iw",				Instruction::CPU_8086},
 		{"TEST",			"EAX,imm32",				"po A9 id",				Instruction::CPU_386},
+		{"TZCNT",			"reg32,r/m32",				"p3 0F BC /r",			Instruction::CPU_BMI1},
 		{"UCOMISD",			"xmmreg,xmm64",				"66 0F 2E /r",			Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"UCOMISS",			"xmmreg,xmm32",				"0F 2E /r",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
 		{"UD2",				"",							"0F 0B",				Instruction::CPU_286},
@@ -1431,6 +1694,7 @@ namespace SoftWire
 		{"XCHG",			"EAX,reg32",				"po 90 +r",				Instruction::CPU_386},
 		{"XCHG",			"reg16,AX",					"po 90 +r",				Instruction::CPU_8086},
 		{"XCHG",			"reg32,EAX",				"po 90 +r",				Instruction::CPU_386},
+		{"XGETBV",			"",							"0F 01 D0",				Instruction::CPU_XSAVE},
 		{"XLATB",			"",							"D7",					Instruction::CPU_8086},
 		{"XOR",				"r/m8,reg8",				"30 /r",				Instruction::CPU_8086},
 		{"XOR",				"r/m16,reg16",				"po 31 /r",				Instruction::CPU_8086},
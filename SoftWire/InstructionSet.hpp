@@ -10,6 +10,31 @@ namespace SoftWire
 	class InstructionSet
 	{
 	public:
+		enum Semantics   // Classified once per instruction, for the code generator
+		{
+			READS_FIRST			= 0x00000001,   // First operand is not written
+			WRITES_SECOND		= 0x00000002,
+			MOVE32				= 0x00000004,   // Register copies and loads
+			MOVE64				= 0x00000008,
+			MOVE128				= 0x00000010,
+			OVERWRITE			= 0x00000020,   // Result doesn't depend on the destination
+			ZERO_IDIOM			= 0x00000040,   // Same for equal operands
+			SCALAR_MOVE			= 0x00000080,
+			MULTIPLY			= 0x00000100,
+			BARRIER				= 0x00000200,   // Stores beyond its memory operand
+			STRING				= 0x00000400,   // When written without operands
+			STRING_STORE		= 0x00000800,
+			CALL				= 0x00001000,
+			JUMP				= 0x00002000,
+			RETURN				= 0x00004000,
+			BRANCH				= 0x00008000,   // Jumps and loops
+			BIT_TEST			= 0x00010000,
+			X87					= 0x00020000,
+			EMPTIES_MMX			= 0x00040000,
+			NEEDS_EMPTY_MMX		= 0x00080000,
+			SSE2_EQUIVALENT		= 0x00100000
+		};
+
 		InstructionSet();
 
 		~InstructionSet();
@@ -17,6 +42,15 @@ namespace SoftWire
 		const Instruction *instruction(int i);
 		Instruction *query(const char *mnemonic) const;
 
+		int semantics(int i) const;
+		unsigned int implicitRegisters(int i) const;   // General-purpose registers written implicitly
+
+		static int numInstructions();
+
+		static void enforceTarget(bool enforce = true);   // Reject instructions the target processor lacks
+		static bool isTargetEnforced();
+		static bool supported(const Instruction *instruction);
+
 	private:
 		struct Entry
 		{
@@ -29,15 +63,20 @@ namespace SoftWire
 
 		Entry *instructionMap;
 		Instruction **intrinsicMap;
+		int *semanticsMap;
+		unsigned int *implicitMap;
+
+		static bool targetEnforced;
 
 		static int compareSyntax(const void *syntax1, const void *syntax2);
 		static int compareEntry(const void *mnemonic, const void *entry);
 
 		static Instruction::Syntax instructionSet[];
 
-		static int numInstructions();
 		static int numMnemonics();
+		static int classify(const char *mnemonic, unsigned int &implicit);
 
+		void classifyIntrinsics();
 		void generateIntrinsics();
 	};
 }
@@ -13,6 +13,7 @@ namespace SoftWire
 
 		Link *append(const T &t);
 		Link *next() const;
+		Link *tail();   // Element filled by the next append
 
 	private:
 		Link *n;   // Next
@@ -58,6 +59,12 @@ namespace SoftWire
 	{
 		return n;
 	}
+
+	template<class T>
+	Link<T> *Link<T>::tail()
+	{
+		return t ? t : this;
+	}
 }
 
 #endif   // SoftWire_Link_hpp
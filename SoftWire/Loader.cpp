@@ -4,32 +4,62 @@
 #include "Error.hpp"
 #include "Linker.hpp"
 #include "String.hpp"
+#include "CPUID.hpp"
+#include "Disassembler.hpp"
+#include "File.hpp"
+
+#include <stdlib.h>
 
 namespace SoftWire
 {
-	Loader::Loader(const Linker &linker) : linker(linker)
+	Loader::Loader(const Linker &linker, InstructionSet &instructionSet) : linker(linker), instructionSet(instructionSet)
 	{
 		possession = true;
 		finalized = false;
 
+		memory = 0;
 		machineCode = 0;
 		instructions = 0;
+		versions = 0;
+		labels = 0;
 		listing = 0;
+		disassembler = 0;
 	}
 
 	Loader::~Loader()
 	{
 		if(possession)
 		{
-			delete[] machineCode;
+			delete[] memory;
+			memory = 0;
 			machineCode = 0;
 		}
 
 		delete instructions;
 		instructions = 0;
 
+		for(VersionTable *version = versions; version; version = version->next())
+		{
+			free(version->routine);
+			free(version->entryLabel);
+		}
+
+		delete versions;
+		versions = 0;
+
+		for(LabelTable *label = labels; label; label = label->next())
+		{
+			delete[] label->name;
+		}
+
+		delete labels;
+		labels = 0;
+
 		delete[] listing;
 		listing = 0;
+
+		delete disassembler;
+		disassembler = 0;
 	}
 
 	void (*Loader::callable(const char *entryLabel))()
@@ -49,7 +79,7 @@ namespace SoftWire
 			return (void(*)())machineCode;
 		}
 
-		const unsigned char *entryPoint = resolveLocal(entryLabel);
+		const unsigned char *entryPoint = resolveEntry(entryLabel);
 
 		if(!entryPoint)
 		{
@@ -71,7 +101,7 @@ namespace SoftWire
 			return (void(*)())machineCode;
 		}
 
-		const unsigned char *entryPoint = resolveLocal(entryLabel);
+		const unsigned char *entryPoint = resolveEntry(entryLabel);
 
 		if(!entryPoint)
 		{
@@ -93,24 +123,144 @@ namespace SoftWire
 	{
 		possession = false;
 
-		return machineCode;
+		return memory;
 	}
 
-	void Loader::appendEncoding(const Encoding &encoding)
+	Encoding *Loader::appendEncoding(const Encoding &encoding)
 	{
 		if(!instructions)
 		{
 			instructions = new Instruction();
 		}
 
+		Instruction *appended = instructions->tail();
 		instructions->append(encoding);
+
+		return appended;
+	}
+
+	bool Loader::writeEncodings(FILE *file) const
+	{
+		if(machineCode)
+		{
+			throw INTERNAL_ERROR;   // References have been resolved
+		}
+
+		int count = 0;
+		const Instruction *instruction;
+
+		for(instruction = instructions; instruction && instruction->next(); instruction = instruction->next())   // Tail is unused
+		{
+			count++;
+		}
+
+		if(fwrite(&count, sizeof(int), 1, file) != 1)
+		{
+			return false;
+		}
+
+		for(instruction = instructions; instruction && instruction->next(); instruction = instruction->next())
+		{
+			if(!instruction->write(file))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool Loader::readEncodings(FILE *file)
+	{
+		int count;
+
+		if(machineCode || instructions || fread(&count, sizeof(int), 1, file) != 1 || count < 0)
+		{
+			return false;
+		}
+
+		Encoding encoding;
+
+		for(int i = 0; i < count; i++)
+		{
+			if(!encoding.read(file))
+			{
+				delete instructions;
+				instructions = 0;
+
+				return false;
+			}
+
+			appendEncoding(encoding);
+		}
+
+		return true;
+	}
+
+	void Loader::defineVersion(const char *routine, const char *entryLabel, int features)
+	{
+		if(!versions)
+		{
+			versions = new VersionTable();
+		}
+
+		versions->append(Version(routine ? strdup(routine) : 0, entryLabel ? strdup(entryLabel) : 0, features));
+	}
+
+	const char *Loader::selectVersion(const char *routine) const
+	{
+		const Version *best = 0;
+		int bestCount = -1;
+
+		for(const VersionTable *version = versions; version; version = version->next())
+		{
+			if(!version->routine || strcmp(version->routine, routine) != 0)
+			{
+				continue;
+			}
+
+			if(!CPUID::supports(version->features))
+			{
+				continue;
+			}
+
+			// Prefer the version using the most features, the first one defined on a tie
+			int count = 0;
+
+			for(int features = version->features; features; features &= features - 1)
+			{
+				count++;
+			}
+
+			if(count > bestCount)
+			{
+				best = version;
+				bestCount = count;
+			}
+		}
+
+		if(best)
+		{
+			return best->entryLabel;
+		}
+
+		for(const VersionTable *version = versions; version; version = version->next())
+		{
+			if(version->routine && strcmp(version->routine, routine) == 0)
+			{
+				throw Error("No version of '%s' supported by target processor", routine);
+			}
+		}
+
+		return routine;
 	}
 
 	void Loader::loadCode(const char *entryLabel)
 	{
 		int length = codeLength();
 
-		machineCode = new unsigned char[length + 16];   // NOTE: Code length is not accurate due to alignment issues
+		memory = new unsigned char[length + 16];   // NOTE: Code length is not accurate due to alignment issues
+		machineCode = memory;
 		unsigned char *currentCode = machineCode;
 
 		Instruction *instruction = instructions;
@@ -160,6 +310,256 @@ namespace SoftWire
 		}
 	}
 
+	bool Loader::writeImage(FILE *file) const
+	{
+		if(!machineCode || !instructions)
+		{
+			return false;
+		}
+
+		const int phase = (int)machineCode & 0xFF;   // Alignment padding depends on the address
+		const int length = codeLength();
+
+		unsigned char *image = new unsigned char[length];
+		memcpy(image, machineCode, length);
+
+		typedef Link<Relocation> RelocationTable;
+		RelocationTable relocations;
+		int relocationCount = 0;
+		int labelCount = 0;
+		bool relocatable = true;
+
+		for(const Instruction *instruction = instructions; instruction; instruction = instruction->next())
+		{
+			const unsigned char *address = instruction->getAddress();
+			const int end = address - machineCode + instruction->length(address);
+			const char *reference = instruction->getReference();
+			const int alignment = instruction->getAlignment();
+
+			if(instruction->getLabel())
+			{
+				labelCount++;
+			}
+
+			if(alignment & (alignment - 1))   // Only powers of two keep their padding at the same phase
+			{
+				relocatable = false;
+			}
+
+			Relocation relocation(end - 4, instruction->relativeReference());
+			int size = instruction->immediateSize();
+
+			if(reference)
+			{
+				const bool local = resolveLocal(reference) != 0;
+
+				if(relocation.relative && local)
+				{
+					continue;
+				}
+
+				if(!relocation.relative && instruction->hasDisplacement())
+				{
+					relocation.offset -= instruction->immediateSize();
+					size = instruction->displacementSize();
+				}
+
+				relocation.symbol = local ? 0 : reference;
+			}
+			else if(!relocation.relative || !instruction->hasImmediate())   // Calls to absolute addresses are relative
+			{
+				continue;
+			}
+
+			if(size != 4)
+			{
+				relocatable = false;
+				break;
+			}
+
+			// Store the field without the address it was resolved to
+			int field;
+			memcpy(&field, image + relocation.offset, 4);
+
+			if(relocation.symbol)
+			{
+				const int address = (int)resolveExternal(relocation.symbol);
+
+				if(!address)
+				{
+					relocatable = false;
+					break;
+				}
+
+				field -= address;
+			}
+			else if(!relocation.relative)
+			{
+				field -= (int)machineCode;
+			}
+
+			if(relocation.relative)
+			{
+				field += (int)machineCode + relocation.offset + 4;
+			}
+
+			memcpy(image + relocation.offset, &field, 4);
+
+			relocations.append(relocation);
+			relocationCount++;
+		}
+
+		bool written = relocatable &&
+		               fwrite(&phase, sizeof(int), 1, file) == 1 &&
+		               fwrite(&length, sizeof(int), 1, file) == 1 &&
+		               fwrite(image, 1, length, file) == (size_t)length &&
+		               fwrite(&labelCount, sizeof(int), 1, file) == 1;
+
+		delete[] image;
+
+		for(const Instruction *instruction = instructions; written && instruction; instruction = instruction->next())
+		{
+			if(instruction->getLabel())
+			{
+				const int offset = instruction->getAddress() - machineCode;
+
+				written = fwrite(&offset, sizeof(int), 1, file) == 1 &&
+				          writeString(file, instruction->getLabel());
+			}
+		}
+
+		written = written && fwrite(&relocationCount, sizeof(int), 1, file) == 1;
+
+		for(const RelocationTable *relocation = &relocations; written && relocation->next(); relocation = relocation->next())
+		{
+			const int flags = relocation->relative;
+
+			written = fwrite(&relocation->offset, sizeof(int), 1, file) == 1 &&
+			          fwrite(&flags, sizeof(int), 1, file) == 1 &&
+			          writeString(file, relocation->symbol);
+		}
+
+		return written;
+	}
+
+	bool Loader::readImage(FILE *file)
+	{
+		int phase;
+		int length;
+
+		if(machineCode || instructions ||
+		   fread(&phase, sizeof(int), 1, file) != 1 ||
+		   fread(&length, sizeof(int), 1, file) != 1 ||
+		   length < 0 || phase < 0 || phase > 0xFF)
+		{
+			return false;
+		}
+
+		// Place the code at the same phase it was assembled at, the leading padding executes as NOPs
+		unsigned char *block = new unsigned char[length + 256];
+		unsigned char *code = block + ((phase - (int)block) & 0xFF);
+		memset(block, 0x90, code - block);
+
+		int labelCount;
+		int relocationCount;
+		bool loaded = fread(code, 1, length, file) == (size_t)length &&
+		              fread(&labelCount, sizeof(int), 1, file) == 1;
+
+		for(int i = 0; loaded && i < labelCount; i++)
+		{
+			Label label;
+
+			loaded = fread(&label.offset, sizeof(int), 1, file) == 1 &&
+			         readString(file, label.name) && label.name &&
+			         label.offset >= 0 && label.offset <= length;
+
+			if(label.name)
+			{
+				if(!labels)
+				{
+					labels = new LabelTable();
+				}
+
+				labels->append(label);
+			}
+		}
+
+		loaded = loaded && fread(&relocationCount, sizeof(int), 1, file) == 1;
+
+		for(int i = 0; loaded && i < relocationCount; i++)
+		{
+			int offset;
+			int flags;
+			char *symbol = 0;
+
+			loaded = fread(&offset, sizeof(int), 1, file) == 1 &&
+			         fread(&flags, sizeof(int), 1, file) == 1 &&
+			         readString(file, symbol) &&
+			         offset >= 0 && offset + 4 <= length;
+
+			int address = 0;
+
+			if(loaded && symbol)
+			{
+				address = (int)resolveExternal(symbol);
+				loaded = address != 0;   // Not defined in this process
+			}
+			else if(!flags)
+			{
+				address = (int)code;
+			}
+
+			if(loaded)
+			{
+				int field;
+				memcpy(&field, code + offset, 4);
+
+				field += address;
+
+				if(flags)
+				{
+					field -= (int)code + offset + 4;
+				}
+
+				memcpy(code + offset, &field, 4);
+			}
+
+			delete[] symbol;
+		}
+
+		if(!loaded)
+		{
+			for(LabelTable *label = labels; label; label = label->next())
+			{
+				delete[] label->name;
+			}
+
+			delete labels;
+			labels = 0;
+
+			delete[] block;
+
+			return false;
+		}
+
+		memory = block;
+		machineCode = code;
+
+		return true;
+	}
+
+	const unsigned char *Loader::resolveEntry(const char *entryLabel) const
+	{
+		const unsigned char *entryPoint = resolveLocal(entryLabel);
+
+		if(entryPoint)
+		{
+			return entryPoint;
+		}
+
+		return resolveLocal(selectVersion(entryLabel));
+	}
+
 	const unsigned char *Loader::resolveReference(const char *name) const
 	{
 		const unsigned char *reference = resolveLocal(name);
@@ -185,6 +585,14 @@ namespace SoftWire
 
 	const unsigned char *Loader::resolveLocal(const char *name) const
 	{
+		for(const LabelTable *label = labels; label; label = label->next())
+		{
+			if(label->name && strcmp(label->name, name) == 0)
+			{
+				return machineCode + label->offset;
+			}
+		}
+
 		const Instruction *instruction = instructions;
 
 		unsigned char *target = machineCode;
@@ -238,15 +646,102 @@ namespace SoftWire
 			return listing;
 		}
 
-		listing = new char[codeLength() * 4];
-		char *buffer = listing;
+		if(!disassembler)
+		{
+			disassembler = new Disassembler(instructionSet);
+		}
+
+		Instruction *instruction;
 
-		for(Instruction *instruction = instructions; instruction; instruction = instruction->next())
+		for(instruction = instructions; instruction; instruction = instruction->next())
 		{
-			buffer += instruction->printCode(buffer);
+			if(instruction->getLabel())
+			{
+				disassembler->defineLabel(instruction->getAddress(), instruction->getLabel());
+			}
+			else if(instruction->getReference() && !resolveLocal(instruction->getReference()))
+			{
+				disassembler->defineLabel(resolveExternal(instruction->getReference()), instruction->getReference());
+			}
+		}
+
+		int capacity = 4096;
+		int size = 0;
+		listing = new char[capacity];
+
+		for(instruction = instructions; instruction; instruction = instruction->next())
+		{
+			const unsigned char *address = instruction->getAddress();
+			const int length = instruction->length(address);
+			const char *label = instruction->getLabel();
+
+			for(int offset = 0; offset < length || (label && offset == 0); )
+			{
+				if(capacity - size < 512)   // Longest line plus label
+				{
+					char *buffer = new char[capacity * 2];
+					memcpy(buffer, listing, size);
+					delete[] listing;
+					listing = buffer;
+					capacity *= 2;
+				}
+
+				char *line = listing + size;
+
+				if(label)
+				{
+					line += sprintf(line, "%s:\n", label);
+					label = 0;
+				}
+
+				if(offset == length)
+				{
+					size = line - listing;
+					break;
+				}
+
+				char text[256];
+				int n;
+
+				if(instruction->isData())
+				{
+					n = length - offset < 8 ? length - offset : 8;
+					char *data = text + sprintf(text, "db ");
+
+					for(int i = 0; i < n; i++)
+					{
+						data += sprintf(data, i == 0 ? "%.2Xh" : ", %.2Xh", address[offset + i]);
+					}
+				}
+				else
+				{
+					n = disassembler->disassemble(address + offset, length - offset, text);
+				}
+
+				line += sprintf(line, "%.8X  ", (unsigned int)(address + offset));
+
+				for(int i = 0; i < 15; i++)   // Longest instruction
+				{
+					line += i < n ? sprintf(line, "%.2X ", address[offset + i]) : sprintf(line, "   ");
+				}
+
+				line += sprintf(line, " %s\n", text);
+
+				size = line - listing;
+				offset += n;
+			}
 		}
 
-		*(buffer - 1) = '\0';
+		disassembler->clearLabels();
+
+		if(size > 0)
+		{
+			listing[size - 1] = '\0';
+		}
+		else
+		{
+			listing[0] = '\0';
+		}
 
 		return listing;
 	}
@@ -3,15 +3,19 @@
 
 #include "Link.hpp"
 
+#include <stdio.h>
+
 namespace SoftWire
 {
 	class Linker;
 	class Encoding;
+	class Disassembler;
+	class InstructionSet;
 
 	class Loader
 	{
 	public:
-		Loader(const Linker &linker);
+		Loader(const Linker &linker, InstructionSet &instructionSet);
 
 		~Loader();
 
@@ -19,23 +23,69 @@ namespace SoftWire
 		void (*finalize(const char *entryLabel = 0))();
 		void *acquire();
 
-		void appendEncoding(const Encoding &encoding);
+		Encoding *appendEncoding(const Encoding &encoding);
+
+		// Unresolved encodings, for precompiled files
+		bool writeEncodings(FILE *file) const;
+		bool readEncodings(FILE *file);
+
+		// Loaded machine code with its labels and relocations, independent of the load address
+		bool writeImage(FILE *file) const;
+		bool readImage(FILE *file);
+
+		void defineVersion(const char *routine, const char *entryLabel, int features);
+		const char *selectVersion(const char *routine) const;
 
 		const char *getListing();
 		void clearListing();
 
 	private:
 		const Linker &linker;
+		InstructionSet &instructionSet;   // For the listing
+
+		struct Version
+		{
+			Version(char *routine = 0, char *entryLabel = 0, int features = 0) : routine(routine), entryLabel(entryLabel), features(features) {};
+
+			char *routine;   // Owned copies
+			char *entryLabel;
+			int features;   // CPUID features required
+		};
+
+		struct Label
+		{
+			Label(int offset = 0, char *name = 0) : offset(offset), name(name) {};
+
+			int offset;
+			char *name;
+		};
+
+		struct Relocation
+		{
+			Relocation(int offset = 0, bool relative = false, const char *symbol = 0) : offset(offset), relative(relative), symbol(symbol) {};
+
+			int offset;   // Of the 32-bit field
+			bool relative;
+			const char *symbol;   // External, or 0 for the code itself
+		};
 
 		typedef Link<Encoding> Instruction;
 		Instruction *instructions;
+
+		typedef Link<Version> VersionTable;
+		VersionTable *versions;
+		typedef Link<Label> LabelTable;
+		LabelTable *labels;   // Of a loaded image
+		unsigned char *memory;
 		unsigned char *machineCode;
 		char *listing;
+		Disassembler *disassembler;
 
 		bool possession;
 		bool finalized;
 
 		void loadCode(const char *entryLabel = 0);
+		const unsigned char *resolveEntry(const char *entryLabel) const;
 		const unsigned char *resolveReference(const char *name) const;
 		const unsigned char *resolveLocal(const char *name) const;
 		const unsigned char *resolveExternal(const char *name) const;
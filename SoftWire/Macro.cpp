@@ -11,16 +11,22 @@ namespace SoftWire
 		scanName(unit);
 		scanArguments(unit);
 		scanDefinition(unit);
+
+		next = 0;
 	}
 
 	Macro::~Macro()
 	{
-		delete[] name;
+	}
+
+	const char *Macro::getName() const
+	{
+		return name;
 	}
 
 	void Macro::scanName(TokenList &unit)
 	{
-		this->name = strdup(unit.getString());
+		name = unit.getString();   // Identifiers are interned
 		unit.erase();
 	}
 
@@ -135,21 +141,10 @@ namespace SoftWire
 		}
 	}
 
-	void Macro::expandAll(TokenList &unit)
+	int Macro::expand(TokenList &unit)
 	{
-		while(!unit.isEndOfFile())
-		{
-			if(unit.isIdentifier(name))
-			{
-				expand(unit);
-			}
-			
-			unit.advance();
-		}
-	}
+		int inserted = 0;
 
-	void Macro::expand(TokenList &unit)
-	{
 		if(hasDefinition())
 		{
 			unit.erase();
@@ -254,6 +249,7 @@ namespace SoftWire
 						{
 							unit.insertBefore(expand.current());
 							unit.advance();
+							inserted++;
 
 							expand.advance();
 						}
@@ -280,10 +276,13 @@ namespace SoftWire
 			{
 				unit.insertBefore(definition.current());
 				unit.advance();
+				inserted++;
 			}
 
 			definition.advance();
 		}
+
+		return inserted;
 	}
 
 	bool Macro::hasArguments() const
@@ -12,10 +12,14 @@ namespace SoftWire
 
 		~Macro();
 
-		void expandAll(TokenList &unit);
+		const char *getName() const;   // Interned
+
+		int expand(TokenList &unit);   // Returns number of tokens inserted
+
+		Macro *next;   // Hash table chain
 
 	private:
-		char *name;
+		const char *name;
 		int numArguments;
 		TokenList arguments;
 		TokenList definition;
@@ -24,8 +28,6 @@ namespace SoftWire
 		void scanArguments(TokenList &unit);
 		void scanDefinition(TokenList &unit);
 
-		void expand(TokenList &unit);
-
 		bool hasArguments() const;
 		bool hasDefinition() const;
 	};
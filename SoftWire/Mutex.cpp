@@ -0,0 +1,46 @@
+#include "Mutex.hpp"
+
+namespace SoftWire
+{
+#ifdef __unix__
+	Mutex::Mutex()
+	{
+		pthread_mutex_init(&mutex, 0);
+	}
+
+	Mutex::~Mutex()
+	{
+		pthread_mutex_destroy(&mutex);
+	}
+
+	void Mutex::lock()
+	{
+		pthread_mutex_lock(&mutex);
+	}
+
+	void Mutex::unlock()
+	{
+		pthread_mutex_unlock(&mutex);
+	}
+#else
+	Mutex::Mutex()
+	{
+		InitializeCriticalSection(&criticalSection);
+	}
+
+	Mutex::~Mutex()
+	{
+		DeleteCriticalSection(&criticalSection);
+	}
+
+	void Mutex::lock()
+	{
+		EnterCriticalSection(&criticalSection);
+	}
+
+	void Mutex::unlock()
+	{
+		LeaveCriticalSection(&criticalSection);
+	}
+#endif
+}
@@ -0,0 +1,42 @@
+#ifndef SoftWire_Mutex_hpp
+#define SoftWire_Mutex_hpp
+
+#ifdef __unix__
+	#include <pthread.h>
+#else
+	#include <windows.h>
+#endif
+
+namespace SoftWire
+{
+	class Mutex
+	{
+	public:
+		Mutex();
+
+		~Mutex();
+
+		void lock();
+		void unlock();
+
+	private:
+		#ifdef __unix__
+			pthread_mutex_t mutex;
+		#else
+			CRITICAL_SECTION criticalSection;
+		#endif
+	};
+
+	class Lock   // Holds a mutex for its scope
+	{
+	public:
+		Lock(Mutex &mutex) : mutex(mutex) {mutex.lock();};
+
+		~Lock() {mutex.unlock();};
+
+	private:
+		Mutex &mutex;
+	};
+}
+
+#endif   // SoftWire_Mutex_hpp
@@ -35,12 +35,17 @@ namespace SoftWire
 
 		int shortestSize = 16;
 		Instruction *bestMatch = 0;
+		bool unsupported = false;
 
 		if(instruction)
 		{
 			do
 			{
-				if(instruction->matchSyntax())
+				if(instruction->matchSyntax() && !InstructionSet::supported(instruction))
+				{
+					unsupported = true;
+				}
+				else if(instruction->matchSyntax())
 				{
 					const int size = instruction->approximateSize();
 
@@ -55,7 +60,11 @@ namespace SoftWire
 			}
 			while(instruction);
 
-			if(!bestMatch)
+			if(!bestMatch && unsupported)
+			{
+				throw Error("Instruction not supported by target processor");
+			}
+			else if(!bestMatch)
 			{
 				throw Error("Operands mismatch");
 			}
@@ -270,6 +279,8 @@ namespace SoftWire
 			return;
 		}
 
+		parseSpecifier();
+
 		Operand thirdOperand = Operand::INIT;
 
 		if(tokenList.isEndOfLine())
@@ -279,6 +290,9 @@ namespace SoftWire
 		{
 			switch(tokenList.getChar())
 			{
+			case '[':
+				thirdOperand = parseMemoryReference();
+				break;
 			case '+':
 			case '-':
 			case '~':
@@ -292,6 +306,10 @@ namespace SoftWire
 		{
 			thirdOperand = parseImmediate();
 		}
+		else if(tokenList.isIdentifier())
+		{
+			thirdOperand = parseRegister();
+		}
 		else
 		{
 			throw Error("Too many operands");
@@ -432,9 +450,9 @@ namespace SoftWire
 
 		while(!tokenList.lookAhead().isEndOfLine())
 		{
-			const Token &prev = tokenList.current();
+			const Token prev = tokenList.current();
 			tokenList.advance();
-			const Token &next = tokenList.lookAhead();
+			const Token next = tokenList.lookAhead();
 
 			if(tokenList.isIdentifier())
 			{
@@ -6,25 +6,67 @@
 #include "String.hpp"
 #include "Macro.hpp"
 #include "Error.hpp"
+#include "CPUID.hpp"
+#include "BitScan.hpp"
 
 #include <stdlib.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SCANNER_SSE2 1   // Always available
+	#define SCANNER_SSE2_TARGET
+#elif defined(_M_IX86) || (defined(__i386__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+	#define SCANNER_SSE2 2   // Chosen at run time
+	#ifdef __GNUC__
+		#define SCANNER_SSE2_TARGET __attribute__((target("sse2")))
+	#else
+		#define SCANNER_SSE2_TARGET
+	#endif
+#endif
+
+#ifdef SCANNER_SSE2
+	#include <emmintrin.h>
+#endif
 
 namespace SoftWire
 {
-	Scanner::SymbolTable *Scanner::symbols;
+	Scanner::Symbol *Scanner::symbols[symbolTableSize];
+	Scanner::IncludeResolver Scanner::includeResolver = 0;
+	void *Scanner::includeContext = 0;
+	Scanner::IncludeCache *Scanner::includeCache = 0;
+	Mutex Scanner::includeMutex;
 
 	Scanner::Scanner()
 	{
+		source = 0;
+		Token::acquireStrings();   // Tokens point into the interned strings
+
 		defineSymbol(1, "true");
 		defineSymbol(0, "false");
+		defineProcessorSymbols();
 	}
 
 	Scanner::Scanner(const char *fileName, bool doPreprocessing)
 	{
-		defineSymbol(1, "true");
-		defineSymbol(0, "false");
+		source = 0;
+		Token::acquireStrings();
+
+		try
+		{
+			defineSymbol(1, "true");
+			defineSymbol(0, "false");
+			defineProcessorSymbols();
 
-		scanFile(fileName, doPreprocessing);
+			scanFile(fileName, doPreprocessing);
+		}
+		catch(...)
+		{
+			delete[] source;
+			Token::releaseStrings();
+			throw;
+		}
 	}
 
 	Scanner::~Scanner()
@@ -32,7 +74,7 @@ namespace SoftWire
 		delete[] source;
 		source = 0;
 
-		clearSymbols();
+		Token::releaseStrings();
 	}
 
 	void Scanner::scanFile(const char *fileName, bool doPreprocessing)
@@ -51,11 +93,81 @@ namespace SoftWire
 
 		const int length = _filelength(fileno(file));
 
-		source = new char[length + 1];
+		delete[] source;
+		source = new char[length + sourcePadding];
 		fread(source, sizeof(char), length, file);
 		fclose(file);
-		source[length] = '\0';
+		memset(&source[length], 0, sourcePadding);
+
+		scanSource(doPreprocessing);
+	}
+
+	void Scanner::scanBuffer(const char *buffer, int length, bool doPreprocessing)
+	{
+		if(!buffer || length < 0)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		delete[] source;
+		source = new char[length + sourcePadding];
+		memcpy(source, buffer, length);
+		memset(&source[length], 0, sourcePadding);
+
+		scanSource(doPreprocessing);
+	}
+
+	void Scanner::scanStream(Reader reader, void *context, bool doPreprocessing)
+	{
+		if(!reader)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		int capacity = 4096;
+		int length = 0;
+
+		delete[] source;
+		source = new char[capacity + sourcePadding];
+
+		while(true)
+		{
+			if(length == capacity)
+			{
+				char *buffer = new char[2 * capacity + sourcePadding];
+				memcpy(buffer, source, length);
+				delete[] source;
+				source = buffer;
+				capacity *= 2;
+			}
+
+			const int n = reader(context, &source[length], capacity - length);
+
+			if(n < 0)
+			{
+				throw Error("Could not read source stream");
+			}
+			else if(n == 0)
+			{
+				break;
+			}
+
+			length += n;
+		}
+
+		memset(&source[length], 0, sourcePadding);
+
+		scanSource(doPreprocessing);
+	}
+
+	void Scanner::setIncludeResolver(IncludeResolver resolver, void *context)
+	{
+		includeResolver = resolver;
+		includeContext = context;
+	}
 
+	void Scanner::scanSource(bool doPreprocessing)
+	{
 		char *lineStart = source;
 
 		int i = 0;
@@ -87,23 +199,13 @@ namespace SoftWire
 				lineStart = &source[i];
 				break;
 			case ';':
-				do
-				{ 
-					i++;
-				}
-				while(source[i] != '\n' && source[i] != '\r' && source[i] != '\0');
-
+				i += lineLength(&source[i]);
 				break;
 			case '/':
 				i++;
 				if(source[i] == '/')
 				{
-					do
-					{
-						i++;
-					}
-					while(source[i] != '\n' && source[i] != '\r' && source[i] != '\0');
-
+					i += lineLength(&source[i]);
 					break;
 				}
 				else if(source[i] == '*')
@@ -136,7 +238,7 @@ namespace SoftWire
 				break;
 			case ' ':
 			case '	':
-				i++;
+				i += whitespaceLength(&source[i]);
 				continue;
 			case '\'':
 				if(isprint(source[++i]))
@@ -271,6 +373,7 @@ namespace SoftWire
 				}
 				break;
 			case '*':
+			case '%':
 			case '+':
 			case '-':
 			case '~':
@@ -293,22 +396,17 @@ namespace SoftWire
 				append(Punctuator(source[i++]));
 				break;
 			default:
-				if(iscsymf(source[i]))
+				if((unsigned char)source[i] < 0x80 && iscsymf(source[i]))   // ASCII only, like identifierLength()
 				{
-					do
-					{
-						if(c >= tokenMax)
-						{
-							throw Error("Token too long");
-						}
+					const int length = identifierLength(&source[i]);
 
-						buffer[c++] = source[i++];
+					if(length >= tokenMax)
+					{
+						throw Error("Token too long");
 					}
-					while(iscsym(source[i]));
 
-					buffer[c] = 0;
-
-					append(Identifier(buffer));
+					append(Identifier(&source[i], length));
+					i += length;
 				}
 				else if(isdigit(source[i]) || source[i] == '.')
 				{
@@ -372,14 +470,239 @@ namespace SoftWire
 		}
 	}
 
+#ifdef SCANNER_SSE2
+	static bool vectorScan()
+	{
+		#if SCANNER_SSE2 == 1
+			return true;
+		#else
+			static int sse2 = -1;   // Detected on first use
+
+			if(sse2 < 0)
+			{
+				sse2 = (CPUID::detect() & CPUID::SSE2) != 0;
+			}
+
+			return sse2 != 0;
+		#endif
+	}
+
+	SCANNER_SSE2_TARGET static int whitespaceLengthSSE2(const char *string)
+	{
+		const __m128i space = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+
+		for(int n = 0; ; n += 16)
+		{
+			const __m128i x = _mm_loadu_si128((const __m128i*)&string[n]);
+			const int mask = ~_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, space), _mm_cmpeq_epi8(x, tab))) & 0xFFFF;
+
+			if(mask)
+			{
+				return n + lowestBit(mask);
+			}
+		}
+	}
+
+	SCANNER_SSE2_TARGET static int lineLengthSSE2(const char *string)
+	{
+		const __m128i newline = _mm_set1_epi8('\n');
+		const __m128i carriage = _mm_set1_epi8('\r');
+		const __m128i zero = _mm_setzero_si128();
+
+		for(int n = 0; ; n += 16)
+		{
+			const __m128i x = _mm_loadu_si128((const __m128i*)&string[n]);
+			const __m128i end = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, newline), _mm_cmpeq_epi8(x, carriage)), _mm_cmpeq_epi8(x, zero));
+			const int mask = _mm_movemask_epi8(end);
+
+			if(mask)
+			{
+				return n + lowestBit(mask);
+			}
+		}
+	}
+
+	SCANNER_SSE2_TARGET static int identifierLengthSSE2(const char *string)
+	{
+		// Bytes above 0x7F compare as negative and fall outside every range
+		for(int n = 0; ; n += 16)
+		{
+			const __m128i x = _mm_loadu_si128((const __m128i*)&string[n]);
+			const __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+			const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+			const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+			const __m128i underscore = _mm_cmpeq_epi8(x, _mm_set1_epi8('_'));
+			const int mask = ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), underscore)) & 0xFFFF;
+
+			if(mask)
+			{
+				return n + lowestBit(mask);
+			}
+		}
+	}
+#endif
+
+	int Scanner::whitespaceLength(const char *string)
+	{
+		#ifdef SCANNER_SSE2
+			if(vectorScan())
+			{
+				return whitespaceLengthSSE2(string);
+			}
+		#endif
+
+		int n = 0;
+
+		while(string[n] == ' ' || string[n] == '\t')
+		{
+			n++;
+		}
+
+		return n;
+	}
+
+	int Scanner::lineLength(const char *string)
+	{
+		#ifdef SCANNER_SSE2
+			if(vectorScan())
+			{
+				return lineLengthSSE2(string);
+			}
+		#endif
+
+		int n = 0;
+
+		while(string[n] != '\n' && string[n] != '\r' && string[n] != '\0')
+		{
+			n++;
+		}
+
+		return n;
+	}
+
+	int Scanner::identifierLength(const char *string)
+	{
+		#ifdef SCANNER_SSE2
+			if(vectorScan())
+			{
+				return identifierLengthSSE2(string);
+			}
+		#endif
+
+		int n = 0;
+
+		while((unsigned char)string[n] < 0x80 && iscsym(string[n]))
+		{
+			n++;
+		}
+
+		return n;
+	}
+
 	void Scanner::preprocess()
 	{
 		includeFiles();
 		substituteSymbols();
 		expandMacros();
+		unrollRepetitions();
 		conditionalCompilation();
 	}
 
+	char *Scanner::fingerprint(unsigned int key[2], int &size)
+	{
+		includeFiles();
+
+		rewind();
+
+		char *stream = 0;
+		int capacity = 0;
+		size = 0;
+
+		while(!isEndOfFile())
+		{
+			if(isIdentifier())
+			{
+				const char *name = getString();
+				record(stream, size, capacity, "i", 1);
+				record(stream, size, capacity, name, strlen(name) + 1);
+
+				for(const Symbol *symbol = symbolBucket(name); symbol; symbol = symbol->next)
+				{
+					if(symbol->name == name)
+					{
+						record(stream, size, capacity, &symbol->value, sizeof(int));
+						break;
+					}
+				}
+			}
+			else if(isInteger())
+			{
+				int integer = getInteger();
+				record(stream, size, capacity, "n", 1);
+				record(stream, size, capacity, &integer, sizeof(int));
+			}
+			else if(isReal())
+			{
+				float real = getReal();
+				record(stream, size, capacity, "r", 1);
+				record(stream, size, capacity, &real, sizeof(float));
+			}
+			else if(isPunctuator())
+			{
+				char c = getChar();
+				record(stream, size, capacity, "p", 1);
+				record(stream, size, capacity, &c, 1);
+			}
+			else if(isLiteral())
+			{
+				record(stream, size, capacity, "s", 1);
+				record(stream, size, capacity, getString(), strlen(getString()) + 1);
+			}
+			else if(isEndOfLine())
+			{
+				record(stream, size, capacity, "e", 1);
+			}
+
+			advance();
+		}
+
+		digest(key, stream, size);
+
+		return stream;
+	}
+
+	void Scanner::record(char *&stream, int &size, int &capacity, const void *data, int length)
+	{
+		if(size + length > capacity)
+		{
+			capacity = 2 * (size + length) + 256;
+			char *grown = new char[capacity];
+
+			if(stream)
+			{
+				memcpy(grown, stream, size);
+			}
+
+			delete[] stream;
+			stream = grown;
+		}
+
+		memcpy(stream + size, data, length);
+		size += length;
+	}
+
+	void Scanner::digest(unsigned int key[2], const void *data, int size)
+	{
+		const unsigned char *bytes = (const unsigned char*)data;
+
+		for(int i = 0; i < size; i++)
+		{
+			key[0] = (key[0] ^ bytes[i]) * 16777619;   // FNV-1a
+			key[1] = (key[1] * 33) ^ bytes[i];   // DJB2a
+		}
+	}
+
 	void Scanner::includeFiles()
 	{
 		rewind();
@@ -422,16 +745,15 @@ namespace SoftWire
 		{
 			if(isIdentifier())
 			{
-				const SymbolTable *symbol = symbols;
+				const char *name = getString();   // Identifiers are interned
 
-				while(symbol)
+				for(const Symbol *symbol = symbolBucket(name); symbol; symbol = symbol->next)
 				{
-					if(symbol->name && strcmp(symbol->name, getString()) == 0)
+					if(symbol->name == name)
 					{
 						overwrite(Integer(symbol->value));
+						break;
 					}
-
-					symbol = symbol->next();
 				}
 			}
 
@@ -441,652 +763,650 @@ namespace SoftWire
 
 	void Scanner::expandMacros()
 	{
-		for(rewind(); !isEndOfFile(); advance())
+		// Macros are looked up as identifiers are encountered, expansions are rescanned
+		enum {macroTableSize = 256};
+		Macro *macros[macroTableSize] = {0};
+
+		enum {maxDepth = 64};
+		struct Expansion
 		{
-			if(isPunctuator('#') &&	
-			   lookAhead().isIdentifier("define"))
-			{
-				erase(2);
-			}
-			else if(isIdentifier("inline"))
-			{
-				erase();
-			}
-			else
-			{
-				continue;
-			}
+			const Macro *macro;
+			int tail;   // Tokens following the expansion
+		};
+
+		Expansion active[maxDepth];
+		int depth = 0;
 
-			if(!isIdentifier())
+		try
+		{
+			for(rewind(); !isEndOfFile();)
 			{
-				throw Error("Expected identifier following define");
-			}
+				while(depth > 0 && size() - position() <= active[depth - 1].tail)
+				{
+					depth--;
+				}
 
-			Macro macro(*this);
+				if((isPunctuator('#') && lookAhead().isIdentifier("define")) || isIdentifier("inline"))
+				{
+					erase(isIdentifier("inline") ? 1 : 2);
 
-			expand(macro);
-		}
-	}
+					if(!isIdentifier())
+					{
+						throw Error("Expected identifier following define");
+					}
 
-	void Scanner::conditionalCompilation()
-	{
-		do
-		{
-			evaluateUnary();
-			evaluateMultiplicative();
-			evaluateAdditive();
-			evaluateRelational();
-			evaluateEquality();
-			evaluateBitwiseAND();
-			evaluateBitwiseOR();
-			evaluateLogicalAND();
-			evaluateLogicalOR();
-		}
-		while(cleanupParenthesis());
-		
-		processDirectives();
-	}
+					Macro *macro = new Macro(*this);
+					Macro **bucket = &macros[((unsigned long)macro->getName() >> 3) % macroTableSize];
 
-	int Scanner::conditionTrue()
-	{
-		// Just ignore these unary operators, they don't influence the outcome
-		if(isPunctuator('+'))
-		{
-			erase();
-		}
-		else if(isPunctuator('-'))
-		{
-			erase();
-		}
+					while(*bucket && (*bucket)->getName() != macro->getName())
+					{
+						bucket = &(*bucket)->next;
+					}
 
-		if(!isInteger())
+					if(*bucket)   // Redefinition
+					{
+						macro->next = (*bucket)->next;
+						delete *bucket;
+					}
+
+					*bucket = macro;
+				}
+				else if(isIdentifier())
+				{
+					const char *name = getString();
+					Macro *macro = macros[((unsigned long)name >> 3) % macroTableSize];
+
+					while(macro && macro->getName() != name)
+					{
+						macro = macro->next;
+					}
+
+					bool recursive = false;
+
+					for(int i = 0; i < depth; i++)
+					{
+						recursive = recursive || active[i].macro == macro;
+					}
+
+					if(macro && !recursive)
+					{
+						if(depth == maxDepth)
+						{
+							throw Error("Macro '%s' nested too deeply", name);
+						}
+
+						const int head = position();
+						const int inserted = expand(*macro);
+
+						active[depth].macro = macro;
+						active[depth].tail = size() - head - inserted;
+						depth++;
+
+						continue;
+					}
+				}
+
+				advance();
+			}
+		}
+		catch(...)
 		{
-			throw INTERNAL_ERROR;
+			deleteMacros(macros, macroTableSize);
+			throw;
 		}
 
-		return getInteger();
+		deleteMacros(macros, macroTableSize);
 	}
 
-	void Scanner::defineSymbol(int value, const char *name)
+	void Scanner::deleteMacros(Macro **macros, int size)
 	{
-		if(!symbols)
+		for(int i = 0; i < size; i++)
 		{
-			symbols = new SymbolTable();
+			while(macros[i])
+			{
+				Macro *next = macros[i]->next;
+				delete macros[i];
+				macros[i] = next;
+			}
 		}
+	}
 
-		SymbolTable *symbol = symbols;
-
-		do
-		{
-			if(symbol->name && strcmp(symbol->name, name) == 0)
-			{
-				symbol->value = value;
-				return;
-			}
-
-			symbol = symbol->next();
-		}
-		while(symbol);
-
-		symbols->append(Symbol(value, name));
-	}
-
-	void Scanner::clearSymbols()
-	{
-		delete symbols;
-		symbols = 0;
-	}
-
-	void Scanner::evaluateUnary()
-	{
-		rewind();
+	void Scanner::unrollRepetitions()
+	{
+		rewind();
 
 		while(!isEndOfFile())
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			if(!isPunctuator('#'))
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				advance();
+				continue;
 			}
 
-			if(!isConstant() && !isIdentifier())
+			// Repetitions in excluded conditional blocks are left for conditionalCompilation() to remove
+			if(lookAhead().isIdentifier("if"))
 			{
-				if(lookAhead().isPunctuator('+'))
-				{
-					advance();
+				const bool excluded = conditionFalse(2);
 
-					if(lookAhead().isConstant())
-					{
-						erase();
-					}
-				}
-				else if(lookAhead().isPunctuator('-'))
-				{
-					advance();
+				advance(2);
 
-					if(lookAhead().isInteger())
-					{
-						overwrite(Integer(-lookAhead().getInteger()));
-						advance();
-						erase();
-					}
-					else if(lookAhead().isReal())
-					{
-						overwrite(Real(-lookAhead().getReal()));
-						advance();
-						erase();
-					}
-				}
-				else
+				if(excluded)
 				{
-					advance();
+					skipBranches(false);
 				}
+
+				continue;
 			}
-			else if(isPunctuator('~'))
+			else if(lookAhead().isIdentifier("elif") || lookAhead().isIdentifier("else"))
 			{
-				if(lookAhead().isInteger())
-				{
-					overwrite(Integer(~lookAhead().getInteger()));
-					advance();
-					erase();
-				}
-				else
-				{
-					advance();
-				}
+				advance(2);
+				skipBranches(true);   // Reached from the included branch
+				continue;
 			}
-			else if(isPunctuator('!'))
+
+			if(lookAhead().isIdentifier("endrep"))
 			{
-				if(lookAhead().isInteger())
-				{
-					overwrite(Integer(!lookAhead().getInteger()));
-					advance();
-					erase();
-				}
-				else
-				{
-					advance();
-				}
+				throw Error("#endrep without matching #rep");
 			}
-			else
+			else if(!lookAhead().isIdentifier("rep"))
 			{
 				advance();
+				continue;
 			}
-		}
-	}
 
-	void Scanner::evaluateMultiplicative()
-	{
-		rewind();
+			erase(2);
 
-		while(!isEndOfFile())
-		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			Constant count;
+			int n = evaluateExpression(0, 1, count);
+
+			if(n == 0 || count.real)
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				throw Error("Expected integer repetition count following #rep");
+			}
+			else if(count.i < 0)
+			{
+				throw Error("Negative repetition count");
 			}
 
-			if(lookAhead().isPunctuator('*'))
+			erase(n);
+
+			const char *index = 0;
+
+			if(isPunctuator(','))
 			{
-				if(isReal() &&
-				   lookAhead(2).isReal())
-				{
-					float value = getReal() * lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if((isReal() &&
-						lookAhead(2).isInteger()))
-				{
-					float value = getReal() * lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isReal())
-				{
-					float value = getInteger() * lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isInteger())
-				{
-					int value = getInteger() * lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
+				erase();
+
+				if(!isIdentifier())
 				{
-					advance();
+					throw Error("Expected index identifier following repetition count");
 				}
+
+				index = getString();
+				erase();
 			}
-			else if(lookAhead().isPunctuator('/'))
+
+			if(!isEndOfLine())
 			{
-				if(isReal() &&
-				   lookAhead(2).isReal())
-				{
-					float value = getReal() / lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if((isReal() &&
-						lookAhead(2).isInteger()))
-				{
-					float value = getReal() / lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isReal())
+				throw Error("Unexpected tokens following #rep directive");
+			}
+
+			advance();
+
+			TokenList body;
+			int nesting = 1;
+
+			while(true)
+			{
+				if(isEndOfFile())
 				{
-					float value = getInteger() / lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
+					throw Error("Unexpected end of file: missing #endrep");
 				}
-				else if(isInteger() &&
-						lookAhead(2).isInteger())
+
+				if(isPunctuator('#') && lookAhead().isIdentifier("rep"))
 				{
-					int value = getInteger() / lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
+					nesting++;
 				}
-				else
+				else if(isPunctuator('#') && lookAhead().isIdentifier("endrep"))
 				{
-					advance();
+					if(--nesting == 0)
+					{
+						erase(2);
+						break;
+					}
 				}
+
+				body.append(current());
+				erase();
 			}
-			else if(lookAhead().isPunctuator('%'))
+
+			if(!isEndOfLine())
 			{
-				if(isInteger() &&
-				   lookAhead(2).isInteger())
-				{
-					int value = getInteger() % lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
+				throw Error("Unexpected tokens following #endrep directive");
+			}
+
+			// Nested repetitions get unrolled when the scan reaches the copies
+			const int start = position();
+
+			for(int i = 0; i < count.i; i++)
+			{
+				for(body.rewind(); !body.isEndOfFile(); body.advance())
 				{
+					if(index && body.isIdentifier(index))
+					{
+						insertBefore(Integer(i));
+					}
+					else
+					{
+						insertBefore(body.current());
+					}
+
 					advance();
 				}
 			}
-			else
-			{
-				advance();
-			}
+
+			seek(start);
 		}
 	}
 
-	void Scanner::evaluateAdditive()
+	void Scanner::skipBranches(bool taken)
 	{
-		rewind();
+		// Advances past the excluded branches of the current #if
+		int nesting = 0;
 
 		while(!isEndOfFile())
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			if(!isPunctuator('#'))
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				advance();
+				continue;
 			}
 
-			if(lookAhead().isPunctuator('+'))
+			const Token &directive = lookAhead();
+
+			if(directive.isIdentifier("if"))
 			{
-				if(isReal() &&
-				   lookAhead(2).isReal())
-				{
-					float value = getReal() + lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if((isReal() &&
-						lookAhead(2).isInteger()))
-				{
-					float value = getReal() + lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isReal())
-				{
-					float value = getInteger() + lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isInteger())
-				{
-					int value = getInteger() + lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
+				nesting++;
 			}
-			else if(lookAhead().isPunctuator('-'))
+			else if(directive.isIdentifier("endif"))
 			{
-				if(isReal() &&
-				   lookAhead(2).isReal())
-				{
-					float value = getReal() - lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if((isReal() &&
-						lookAhead(2).isInteger()))
-				{
-					float value = getReal() - lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isReal())
-				{
-					float value = getInteger() - lookAhead(2).getReal();
-					erase(2);
-					overwrite(Real(value));
-				}
-				else if(isInteger() &&
-						lookAhead(2).isInteger())
+				if(nesting-- == 0)
 				{
-					int value = getInteger() - lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
+					advance(2);
+					return;
 				}
 			}
-			else
+			else if(nesting == 0 && !taken && directive.isIdentifier("else") && !lookAhead(2).isIdentifier("if"))
 			{
-				advance();
+				advance(2);
+				return;
 			}
+			else if(nesting == 0 && !taken && (directive.isIdentifier("elif") || directive.isIdentifier("else")))
+			{
+				const int start = directive.isIdentifier("elif") ? 2 : 3;
+
+				if(!conditionFalse(start))
+				{
+					advance(start);
+					return;
+				}
+			}
+
+			advance();
 		}
 	}
 
-	void Scanner::evaluateRelational()
+	bool Scanner::conditionFalse(int start) const
 	{
-		rewind();
+		// Only when known before expressions get evaluated
+		Constant value;
+		int n = evaluateExpression(start, 1, value);
 
-		while(!isEndOfFile())
+		return n > 0 && !value.real && value.i == 0 && lookAhead(start + n).isEndOfLine();
+	}
+
+	void Scanner::conditionalCompilation()
+	{
+		evaluateExpressions();
+		processDirectives();
+	}
+
+	int Scanner::conditionTrue()
+	{
+		// Just ignore these unary operators, they don't influence the outcome
+		if(isPunctuator('+'))
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			erase();
+		}
+		else if(isPunctuator('-'))
+		{
+			erase();
+		}
+
+		if(!isInteger())
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		return getInteger();
+	}
+
+	void Scanner::defineSymbol(int value, const char *name)
+	{
+		Token::acquireStrings();   // Held by the symbol's name
+		name = Token::intern(name);
+		Symbol *&bucket = symbolBucket(name);
+
+		for(Symbol *symbol = bucket; symbol; symbol = symbol->next)
+		{
+			if(symbol->name == name)
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				symbol->value = value;
+				Token::releaseStrings();
+				return;
 			}
+		}
+
+		Symbol *symbol = new Symbol;
+		symbol->value = value;
+		symbol->name = name;
+		symbol->next = bucket;
+		bucket = symbol;
+	}
 
-			if(lookAhead().isPunctuator('<'))
+	void Scanner::clearSymbols()
+	{
+		for(int i = 0; i < symbolTableSize; i++)
+		{
+			while(symbols[i])
 			{
-				if(isInteger() &&
-				   lookAhead(2).isInteger())
-				{
-					int value = getInteger() < lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else if(isInteger() &&
-				        lookAhead(2).isPunctuator('=') &&
-						lookAhead(3).isInteger())
-				{
-					int value = getInteger() <= lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
+				Symbol *next = symbols[i]->next;
+				delete symbols[i];
+				symbols[i] = next;
+
+				Token::releaseStrings();
 			}
-			else if(lookAhead().isPunctuator('>'))
+		}
+	}
+
+	Scanner::Symbol *&Scanner::symbolBucket(const char *name)
+	{
+		// Interned names are unique, so their address serves as the hash
+		return symbols[((unsigned long)name >> 3) % symbolTableSize];
+	}
+
+	void Scanner::defineProcessorSymbols()
+	{
+		for(int i = 0; CPUID::symbolSet[i].name; i++)
+		{
+			const char *name = Token::intern(CPUID::symbolSet[i].name);
+			const Symbol *symbol = symbolBucket(name);
+
+			while(symbol && symbol->name != name)
 			{
-				if(isInteger() &&
-				   lookAhead(2).isInteger())
-				{
-					int value = getInteger() > lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else if(isInteger() &&
-				        lookAhead(2).isPunctuator('=') &&
-						lookAhead(3).isInteger())
-				{
-					int value = getInteger() >= lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
-				}	
-				else
-				{
-					advance();
-				}
+				symbol = symbol->next;
 			}
-			else
+
+			if(!symbol)   // Not defined by the application
 			{
-				advance();
+				defineSymbol(CPUID::supports(CPUID::symbolSet[i].features), name);
 			}
 		}
 	}
 
-	void Scanner::evaluateEquality()
+	void Scanner::evaluateExpressions()
 	{
+		// Precedence of the binary operator preceding the current token
+		const int NONE = 0;
+		const int OPERAND = -1;
+
+		int context = NONE;
+
 		rewind();
 
 		while(!isEndOfFile())
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			if(isPunctuator('(') && lookAhead().isPunctuator(')'))
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				throw Error("Empty parenthesis");
 			}
 
-			if(lookAhead().isPunctuator('='))
+			// After an operand a sign is a binary operator
+			if(context != OPERAND || !(isPunctuator('+') || isPunctuator('-')))
 			{
-				if(isInteger() &&
-				   lookAhead(2).isPunctuator('=') &&
-				   lookAhead(3).isInteger())
+				Constant value;
+				int n = evaluateExpression(0, context > NONE ? context + 1 : 1, value);
+
+				if(n > 1)
 				{
-					int value = getInteger() == lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
+					erase(n - 1);
+
+					if(value.real)
+					{
+						overwrite(Real(value.r));
+					}
+					else
+					{
+						overwrite(Integer(value.i));
+					}
 				}
-				else
+
+				if(n > 0)
 				{
 					advance();
+					context = OPERAND;
+					continue;
 				}
 			}
-			else if(lookAhead().isPunctuator('!'))
+
+			int length = 0;
+			int precedence = context == OPERAND ? binaryOperator(0, length) : NONE;
+
+			if(precedence)
 			{
-				if(isInteger() &&
-				   lookAhead(2).isPunctuator('=') &&
-				   lookAhead(3).isInteger())
-				{
-					int value = getInteger() != lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
-				}	
-				else
-				{
-					advance();
-				}
+				advance(length);
+				context = precedence;
 			}
 			else
 			{
+				context = (isIdentifier() || isLiteral() || isPunctuator(')') || isPunctuator(']')) ? OPERAND : NONE;
 				advance();
 			}
 		}
 	}
 
-	void Scanner::evaluateBitwiseAND()
+	int Scanner::evaluateExpression(int start, int minPrecedence, Constant &value) const
 	{
-		rewind();
+		// Returns the number of tokens which can be folded into value
+		int n = evaluatePrimary(start, value);
 
-		while(!isEndOfFile())
+		if(n == 0)
+		{
+			return 0;
+		}
+
+		while(true)
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			int length = 0;
+			int precedence = binaryOperator(start + n, length);
+
+			if(precedence == 0 || precedence < minPrecedence)
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				return n;
 			}
 
-			if(lookAhead().isPunctuator('&'))
+			const char op = lookAhead(start + n).getChar();
+			const char op2 = length == 2 ? lookAhead(start + n + 1).getChar() : '\0';
+
+			Constant rhs;
+			int m = evaluateExpression(start + n + length, precedence + 1, rhs);
+
+			// Stop when the right-hand side doesn't fold completely
+			if(m == 0 || binaryOperator(start + n + length + m, length) > precedence)
 			{
-				if(isInteger() &&
-				   lookAhead(2).isInteger())
-				{
-					int value = getInteger() & lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
+				return n;
 			}
-			else
+
+			if(!evaluateBinary(op, op2, value, rhs))
 			{
-				advance();
+				return n;
 			}
+
+			n += (op2 ? 2 : 1) + m;
 		}
 	}
 
-	void Scanner::evaluateBitwiseOR()
+	int Scanner::evaluatePrimary(int start, Constant &value) const
 	{
-		rewind();
+		const Token &token = lookAhead(start);
 
-		while(!isEndOfFile())
+		if(token.isInteger())
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
+			value.real = false;
+			value.i = token.getInteger();
+
+			return 1;
+		}
+		else if(token.isReal())
+		{
+			value.real = true;
+			value.r = token.getReal();
+
+			return 1;
+		}
+		else if(token.isPunctuator('('))
+		{
+			int n = evaluateExpression(start + 1, 1, value);
+
+			if(n == 0 || !lookAhead(start + 1 + n).isPunctuator(')'))
 			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
+				return 0;
 			}
 
-			if(lookAhead().isPunctuator('|'))
+			return n + 2;
+		}
+		else if(token.isPunctuator('+') || token.isPunctuator('-') || token.isPunctuator('~') || token.isPunctuator('!'))
+		{
+			int n = evaluatePrimary(start + 1, value);
+
+			if(n == 0)
 			{
-				if(isInteger() &&
-				   lookAhead(2).isInteger())
-				{
-					int value = getInteger() | lookAhead(2).getInteger();
-					erase(2);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
+				return 0;
 			}
-			else
+
+			switch(token.getChar())
 			{
-				advance();
+			case '+':
+				break;
+			case '-':
+				if(value.real) value.r = -value.r;
+				else value.i = -value.i;
+				break;
+			case '~':
+				if(value.real) return 0;
+				value.i = ~value.i;
+				break;
+			case '!':
+				if(value.real) return 0;
+				value.i = !value.i;
+				break;
 			}
+
+			return n + 1;
 		}
+
+		return 0;
 	}
 
-	void Scanner::evaluateLogicalAND()
+	int Scanner::binaryOperator(int start, int &length) const
 	{
-		rewind();
+		const Token &token = lookAhead(start);
 
-		while(!isEndOfFile())
+		if(!token.isPunctuator())
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
-			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
-			}
+			return 0;
+		}
 
-			if(lookAhead().isPunctuator('&'))
-			{
-				if(isInteger() &&
-				   lookAhead(2).isPunctuator('&') &&
-				   lookAhead(3).isInteger())
-				{
-					int value = getInteger() && lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
-			}
-			else
-			{
-				advance();
-			}
+		const char c = token.getChar();
+		const char next = lookAhead(start + 1).isPunctuator() ? lookAhead(start + 1).getChar() : '\0';
+
+		length = 1;
+
+		switch(c)
+		{
+		case '*':
+		case '/':
+		case '%':
+			return 8;
+		case '+':
+		case '-':
+			return 7;
+		case '<':
+		case '>':
+			if(next == '=') length = 2;
+			return 6;
+		case '=':
+		case '!':
+			length = 2;
+			return next == '=' ? 5 : 0;
+		case '&':
+			if(next == '&') {length = 2; return 2;}
+			return 4;
+		case '|':
+			if(next == '|') {length = 2; return 1;}
+			return 3;
 		}
+
+		return 0;
 	}
 
-	void Scanner::evaluateLogicalOR()
+	bool Scanner::evaluateBinary(char op, char op2, Constant &value, const Constant &rhs)
 	{
-		rewind();
-
-		while(!isEndOfFile())
+		if(value.real || rhs.real)
 		{
-			// Don't do any evaluation on memory references
-			if(isPunctuator('['))
-			{
-				do
-				{
-					advance();
-				}
-				while(!isPunctuator(']'));
-			}
+			const float x = value.real ? value.r : value.i;
+			const float y = rhs.real ? rhs.r : rhs.i;
 
-			if(lookAhead().isPunctuator('|'))
+			switch(op)
 			{
-				if(isInteger() &&
-				   lookAhead(2).isPunctuator('|') &&
-				   lookAhead(3).isInteger())
-				{
-					int value = getInteger() || lookAhead(3).getInteger();
-					erase(3);
-					overwrite(Integer(value));
-				}
-				else
-				{
-					advance();
-				}
+			case '*':	value.r = x * y;	break;
+			case '/':	value.r = x / y;	break;
+			case '+':	value.r = x + y;	break;
+			case '-':	value.r = x - y;	break;
+			default:	return false;   // Integer operators only
 			}
-			else
+
+			value.real = true;
+
+			return true;
+		}
+
+		const int x = value.i;
+		const int y = rhs.i;
+
+		switch(op)
+		{
+		case '*':	value.i = x * y;	break;
+		case '/':
+		case '%':
+			if(y == 0)
 			{
-				advance();
+				throw Error("Division by zero in constant expression");
 			}
+
+			value.i = op == '/' ? x / y : x % y;
+			break;
+		case '+':	value.i = x + y;	break;
+		case '-':	value.i = x - y;	break;
+		case '<':	value.i = op2 == '=' ? x <= y : x < y;	break;
+		case '>':	value.i = op2 == '=' ? x >= y : x > y;	break;
+		case '=':	value.i = x == y;	break;
+		case '!':	value.i = x != y;	break;
+		case '&':	value.i = op2 == '&' ? x && y : x & y;	break;
+		case '|':	value.i = op2 == '|' ? x || y : x | y;	break;
+		default:	return false;
 		}
+
+		return true;
 	}
 
 	void Scanner::processDirectives()
@@ -1222,6 +1542,10 @@ namespace SoftWire
 
 						indent--;
 					}
+					else if(indent != active)
+					{
+						// Excluded, such as #rep left by unrollRepetitions()
+					}
 					else
 					{
 						throw Error("Invalid preprocessor directive '%s'", getString());
@@ -1267,40 +1591,90 @@ namespace SoftWire
 		}
 	}
 
-	bool Scanner::cleanupParenthesis()
+	void Scanner::includeFile(const char *fileName)
 	{
-		rewind();
+		int length = 0;
+		const char *buffer = includeResolver ? includeResolver(includeContext, fileName, length) : 0;
 
-		bool notDone = false;
+		Lock lock(includeMutex);   // Entries can be cleared once it's released
 
-		while(!isEndOfFile())
+		paste(cachedInclude(fileName, buffer, length));
+	}
+
+	const Scanner &Scanner::cachedInclude(const char *fileName, const char *buffer, int length)
+	{
+		// Files are identified by modification time, in-memory includes by content
+		time_t modified = 0;
+		unsigned int hash = 2166136261u;
+
+		if(buffer)
 		{
-			if(isPunctuator('(') && lookAhead().isPunctuator(')'))
+			for(int i = 0; i < length; i++)
 			{
-				throw Error("Empty parenthesis");
+				hash = (hash ^ (unsigned char)buffer[i]) * 16777619u;
 			}
+		}
+		else
+		{
+			struct stat status;
 
-			if(isPunctuator('(') && lookAhead().isConstant() && lookAhead(2).isPunctuator(')'))
+			if(stat(fileName, &status) != 0)
 			{
-				erase();
-				advance();
-				erase();
+				throw Error("Could not open source file: '%s'\n", fileName);
+			}
 
-				notDone = true;
+			modified = status.st_mtime;
+			length = status.st_size;
+		}
+
+		for(const IncludeCache *include = includeCache; include && include->fileName; include = include->next())
+		{
+			if(include->modified == modified && include->hash == hash && include->length == length && strcmp(include->fileName, fileName) == 0)
+			{
+				return *include->tokens;
+			}
+		}
+
+		Scanner *tokens = new Scanner();
+
+		try
+		{
+			if(buffer)
+			{
+				tokens->scanBuffer(buffer, length, false);
 			}
 			else
 			{
-				advance();
+				tokens->scanFile(fileName, false);
 			}
 		}
+		catch(...)
+		{
+			delete tokens;
+			throw;
+		}
+
+		if(!includeCache)
+		{
+			includeCache = new IncludeCache();
+		}
+
+		includeCache->append(Include(strdup(fileName), modified, hash, length, tokens));
 
-		return notDone;
+		return *tokens;
 	}
 
-	void Scanner::includeFile(const char *fileName)
+	void Scanner::clearIncludeCache()
 	{
-		Scanner file(fileName, false);
+		Lock lock(includeMutex);
+
+		for(IncludeCache *include = includeCache; include; include = include->next())
+		{
+			free(include->fileName);
+			delete include->tokens;
+		}
 
-		paste(file);
+		delete includeCache;
+		includeCache = 0;
 	}
 }
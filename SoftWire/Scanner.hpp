@@ -4,6 +4,9 @@
 #include "TokenList.hpp"
 
 #include "Link.hpp"
+#include "Mutex.hpp"
+
+#include <time.h>
 
 namespace SoftWire
 {
@@ -15,48 +18,95 @@ namespace SoftWire
 
 		~Scanner();
 
+		// Returns the number of bytes read, 0 at the end of the source, negative on failure
+		typedef int (*Reader)(void *context, char *buffer, int size);
+
+		// Returns the source of an included file, or 0 to read it from disk
+		typedef const char *(*IncludeResolver)(void *context, const char *fileName, int &length);
+
 		void scanFile(const char *fileName, bool doPreprocessing = true);
+		void scanBuffer(const char *buffer, int length, bool doPreprocessing = true);
+		void scanStream(Reader reader, void *context, bool doPreprocessing = true);
+
+		static void setIncludeResolver(IncludeResolver resolver, void *context = 0);
+		static void clearIncludeCache();   // Included files are tokenized once per process
 
 		static void defineSymbol(int value, const char *name);
 		static void clearSymbols();
 
+		void preprocess();   // When scanned without preprocessing
+		char *fingerprint(unsigned int key[2], int &size);   // Tokens of the included source with the referenced symbol values, hashed into key
+
 	private:
 		struct Symbol
 		{
-			Symbol(int value = 0, const char *name = 0) : value(value), name(name) {};
-
 			int value;
-			const char *name;
+			const char *name;   // Interned
+			Symbol *next;
+		};
+
+		struct Constant
+		{
+			bool real;
+			int i;
+			float r;
 		};
 
 		char *source;
 
 		enum {tokenMax = 256};   // Maximum token length
+		enum {sourcePadding = 16};   // Zeroes following the source, allows reading whole vectors
+
+		enum {symbolTableSize = 256};
+		static Symbol *symbols[symbolTableSize];
+
+		static IncludeResolver includeResolver;
+		static void *includeContext;
+
+		struct Include
+		{
+			Include(char *fileName = 0, time_t modified = 0, unsigned int hash = 0, int length = 0, Scanner *tokens = 0) :
+				fileName(fileName), modified(modified), hash(hash), length(length), tokens(tokens) {};
+
+			char *fileName;
+			time_t modified;
+			unsigned int hash;
+			int length;
+			Scanner *tokens;
+		};
 
-		typedef Link<Symbol> SymbolTable;
-		static SymbolTable *symbols;
+		typedef Link<Include> IncludeCache;
+		static IncludeCache *includeCache;
+		static Mutex includeMutex;
 
-		void preprocess();
+		static Symbol *&symbolBucket(const char *name);
+		static void defineProcessorSymbols();
+
+		void scanSource(bool doPreprocessing);
+		static int whitespaceLength(const char *string);
+		static int lineLength(const char *string);
+		static int identifierLength(const char *string);
+		static void digest(unsigned int key[2], const void *data, int size);
+		static void record(char *&stream, int &size, int &capacity, const void *data, int length);
 		void includeFiles();
 		void substituteSymbols();
 		void expandMacros();
+		void unrollRepetitions();
+		void skipBranches(bool taken);
+		bool conditionFalse(int start) const;
+		static void deleteMacros(Macro **macros, int size);
 		void conditionalCompilation();
 
 		int conditionTrue();
-		void evaluateUnary();
-		void evaluateMultiplicative();
-		void evaluateAdditive();
-		void evaluateRelational();
-		void evaluateEquality();
-		void evaluateBitwiseAND();
-		void evaluateBitwiseOR();
-		void evaluateLogicalAND();
-		void evaluateLogicalOR();
+		void evaluateExpressions();
+		int evaluateExpression(int start, int minPrecedence, Constant &value) const;
+		int evaluatePrimary(int start, Constant &value) const;
+		int binaryOperator(int start, int &length) const;
+		static bool evaluateBinary(char op, char op2, Constant &value, const Constant &rhs);
 		void processDirectives();
 
-		bool cleanupParenthesis();
-
 		void includeFile(const char *fileName);
+		static const Scanner &cachedInclude(const char *fileName, const char *buffer, int length);   // Holding includeMutex
 	};
 }
 
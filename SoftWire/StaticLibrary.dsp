@@ -93,6 +93,14 @@ SOURCE=.\CodeGenerator.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CPUID.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\Disassembler.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Encoding.cpp
 # End Source File
 # Begin Source File
@@ -121,6 +129,10 @@ SOURCE=.\Macro.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Mutex.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Operand.cpp
 # End Source File
 # Begin Source File
@@ -153,6 +165,10 @@ SOURCE=.\Assembler.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\BitScan.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CharType.hpp
 # End Source File
 # Begin Source File
@@ -161,6 +177,14 @@ SOURCE=.\CodeGenerator.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CPUID.hpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\Disassembler.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Encoding.hpp
 # End Source File
 # Begin Source File
@@ -205,6 +229,10 @@ SOURCE=.\Macro.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Mutex.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Operand.hpp
 # End Source File
 # Begin Source File
@@ -23,13 +23,20 @@ namespace SoftWire
 
 		firstType = Operand::UNKNOWN;
 		secondType = Operand::UNKNOWN;
+		thirdType = Operand::UNKNOWN;
+
+		firstSyntax = Operand::UNKNOWN;
+		secondSyntax = Operand::UNKNOWN;
+		thirdSyntax = Operand::UNKNOWN;
 
 		firstReg = Encoding::REG_UNKNOWN;
 		secondReg = Encoding::REG_UNKNOWN;
+		thirdReg = Encoding::REG_UNKNOWN;
 		baseReg = Encoding::REG_UNKNOWN;
 		indexReg = Encoding::REG_UNKNOWN;
 		
 		scale = 0;
+		vexEscape = 0;
 	}
 
 	void Synthesizer::defineLabel(const char *label)
@@ -126,12 +133,33 @@ namespace SoftWire
 
 	void Synthesizer::encodeThirdOperand(const Operand &thirdOperand)
 	{
-		if(Operand::isImm(thirdOperand))
+		if(thirdType != Operand::UNKNOWN)
+		{
+			throw INTERNAL_ERROR;   // Instruction third operand already set
+		}
+
+		thirdType = thirdOperand.type;
+
+		if(Operand::isReg(thirdType))
+		{
+			thirdReg = thirdOperand.reg;
+		}
+		else if(Operand::isMem(thirdType))
+		{
+			encodeBase(thirdOperand);
+			encodeIndex(thirdOperand);
+
+			setScale(thirdOperand.scale);
+			setDisplacement(thirdOperand.displacement);
+
+			referenceLabel(thirdOperand.reference);
+		}
+		else if(Operand::isImm(thirdType))
 		{
 			encodeImmediate(thirdOperand.value);
 			referenceLabel(thirdOperand.reference);
 		}
-		else if(!Operand::isVoid(thirdOperand))
+		else if(!Operand::isVoid(thirdType))
 		{
 			throw INTERNAL_ERROR;
 		}
@@ -210,6 +238,10 @@ namespace SoftWire
 			throw INTERNAL_ERROR;
 		}
 
+		firstSyntax = instruction->getFirstOperand();
+		secondSyntax = instruction->getSecondOperand();
+		thirdSyntax = instruction->getThirdOperand();
+
 		while(*format)
 		{
 			switch((format[0] << 8) | format[1])
@@ -221,10 +253,24 @@ namespace SoftWire
 				encoding.addPrefix(0xF1);
 				break;
 			case REPNE_PRE:
-				encoding.addPrefix(0xF2);
+				if(encoding.format.VEX)
+				{
+					encoding.VEX.pp = 3;
+				}
+				else
+				{
+					encoding.addPrefix(0xF2);
+				}
 				break;
 			case REP_PRE:
-				encoding.addPrefix(0xF3);
+				if(encoding.format.VEX)
+				{
+					encoding.VEX.pp = 2;
+				}
+				else
+				{
+					encoding.addPrefix(0xF3);
+				}
 				break;
 			case OFF_PRE:
 				if(!instruction->is32Bit())
@@ -238,6 +284,13 @@ namespace SoftWire
 					encoding.addPrefix(0x67);
 				}
 				break;
+			case VEX_0:
+			case VEX_1:
+			case VEX_2:
+			case VEX_3:
+				encoding.format.VEX = true;
+				encodeVexRegister(format[1] - '0');
+				break;
 			case ADD_REG:
 				if(encoding.format.O1)
 				{
@@ -261,8 +314,8 @@ namespace SoftWire
 				break;
 			case EFF_ADDR:
 				encodeModField();
-				encodeRegField(instruction);
-				encodeR_MField(instruction);
+				encodeRegField();
+				encodeR_MField();
 
 				encodeSibByte();
 
@@ -277,7 +330,7 @@ namespace SoftWire
 			case MOD_RM_7:
 				encodeModField();
 				encoding.modRM.reg = (Encoding::Reg)(format[1] - '0');
-				encodeR_MField(instruction);
+				encodeR_MField();
 
 				encodeSibByte();
 
@@ -314,7 +367,15 @@ namespace SoftWire
 					throw INTERNAL_ERROR;
 				}
 
-				if(!encoding.format.O1)
+				if(encoding.format.VEX && !encoding.format.O1)
+				{
+					encodeVexOpcode(opcode);
+				}
+				else if(!encoding.format.O1 && opcode == 0x66)   // Mandatory operand size prefix
+				{
+					encoding.addPrefix(0x66);
+				}
+				else if(!encoding.format.O1)
 				{
 					encoding.O1 = (unsigned char)opcode;
 
@@ -342,6 +403,16 @@ namespace SoftWire
 
 					encoding.O1 = opcode;
 				}
+				else if(!encoding.format.O3 &&
+				        encoding.format.O2 && encoding.O2 == 0x0F &&
+				        (encoding.O1 == 0x38 || encoding.O1 == 0x3A))   // Three byte opcode
+				{
+					encoding.O3 = encoding.O2;
+					encoding.O2 = encoding.O1;
+					encoding.O1 = opcode;
+
+					encoding.format.O3 = true;
+				}
 				else   // 3DNow!, SSE or SSE2 instruction, opcode as immediate
 				{
 					encoding.format.I1 = true;
@@ -369,6 +440,85 @@ namespace SoftWire
 		return encoding;
 	}
 
+	void Synthesizer::encodeVexRegister(int operand)
+	{
+		Encoding::Reg reg = Encoding::REG_UNKNOWN;
+
+		// Take the register out of the operand list so the remaining operands map on mod R/M
+		switch(operand)
+		{
+		case 0:
+			return;
+		case 1:
+			reg = firstReg;
+
+			firstType = secondType;
+			firstReg = secondReg;
+			firstSyntax = secondSyntax;
+
+			secondType = thirdType;
+			secondReg = thirdReg;
+			secondSyntax = thirdSyntax;
+			break;
+		case 2:
+			reg = secondReg;
+
+			secondType = thirdType;
+			secondReg = thirdReg;
+			secondSyntax = thirdSyntax;
+			break;
+		case 3:
+			reg = thirdReg;
+			break;
+		default:
+			throw INTERNAL_ERROR;
+		}
+
+		if(reg == Encoding::REG_UNKNOWN)
+		{
+			throw INTERNAL_ERROR;   // VEX operand must be a register
+		}
+
+		thirdType = Operand::VOID;
+		thirdReg = Encoding::REG_UNKNOWN;
+		thirdSyntax = Operand::VOID;
+
+		encoding.VEX.vvvv = ~reg & 0xF;
+	}
+
+	void Synthesizer::encodeVexOpcode(unsigned char opcode)
+	{
+		if(vexEscape == 0 && opcode == 0x66)
+		{
+			encoding.VEX.pp = 1;
+		}
+		else if(vexEscape == 0 && opcode == 0x0F)
+		{
+			encoding.VEX.mmmmm = 1;
+			vexEscape = 1;
+		}
+		else if(vexEscape == 1 && opcode == 0x38)
+		{
+			encoding.VEX.mmmmm = 2;
+			vexEscape = 2;
+		}
+		else if(vexEscape == 1 && opcode == 0x3A)
+		{
+			encoding.VEX.mmmmm = 3;
+			vexEscape = 2;
+		}
+		else if(vexEscape != 0)
+		{
+			encoding.O1 = opcode;
+
+			encoding.format.O1 = true;
+		}
+		else
+		{
+			throw INTERNAL_ERROR;   // VEX instructions need an opcode map
+		}
+	}
+
 	void Synthesizer::encodeModField()
 	{
 		encoding.format.modRM = true;
@@ -416,10 +566,10 @@ namespace SoftWire
 		}
 	}
 
-	void Synthesizer::encodeR_MField(const Instruction *instruction)
+	void Synthesizer::encodeR_MField()
 	{
-		if(Operand::isReg(instruction->getFirstOperand()) &&
-		   Operand::isR_M(instruction->getSecondOperand()))
+		if(Operand::isReg(firstSyntax) &&
+		   Operand::isR_M(secondSyntax))
 		{
 			if(Operand::isMem(secondType))
 			{
@@ -441,8 +591,8 @@ namespace SoftWire
 				throw INTERNAL_ERROR;   // Syntax error should be detected by parser
 			}
 		}
-		else if(Operand::isR_M(instruction->getFirstOperand()) &&
-		        Operand::isReg(instruction->getSecondOperand()))
+		else if(Operand::isR_M(firstSyntax) &&
+		        Operand::isReg(secondSyntax))
 		{
 			if(Operand::isMem(firstType))
 			{
@@ -488,20 +638,20 @@ namespace SoftWire
 		}
 	}
 
-	void Synthesizer::encodeRegField(const Instruction *instruction)
+	void Synthesizer::encodeRegField()
 	{
-		if(Operand::isReg(instruction->getFirstOperand()) &&
-		   Operand::isR_M(instruction->getSecondOperand()))
+		if(Operand::isReg(firstSyntax) &&
+		   Operand::isR_M(secondSyntax))
 		{
 			encoding.modRM.reg = firstReg;
 		}
-		else if(Operand::isR_M(instruction->getFirstOperand()) &&
-		        Operand::isReg(instruction->getSecondOperand()))
+		else if(Operand::isR_M(firstSyntax) &&
+		        Operand::isReg(secondSyntax))
 		{
 			encoding.modRM.reg = secondReg;
 		}
-		else if(Operand::isReg(instruction->getFirstOperand()) &&
-		        Operand::isImm(instruction->getSecondOperand()))   // IMUL working on the same register
+		else if(Operand::isReg(firstSyntax) &&
+		        Operand::isImm(secondSyntax))   // IMUL working on the same register
 		{
 			encoding.modRM.reg = firstReg;
 		}
@@ -33,13 +33,20 @@ namespace SoftWire
 
 		Operand::Type firstType;
 		Operand::Type secondType;
+		Operand::Type thirdType;
+
+		Operand::Type firstSyntax;
+		Operand::Type secondSyntax;
+		Operand::Type thirdSyntax;
 
 		Encoding::Reg firstReg;
 		Encoding::Reg secondReg;
+		Encoding::Reg thirdReg;
 		Encoding::Reg baseReg;
 		Encoding::Reg indexReg;
 
 		int scale;
+		int vexEscape;
 
 		void encodeBase(const Operand &base);
 		void encodeIndex(const Operand &index);
@@ -49,9 +56,12 @@ namespace SoftWire
 
 		void referenceLabel(const char *label);
 
+		void encodeVexRegister(int operand);
+		void encodeVexOpcode(unsigned char opcode);
+
 		void encodeModField();
-		void encodeR_MField(const Instruction *instruction);
-		void encodeRegField(const Instruction *instruction);
+		void encodeR_MField();
+		void encodeRegField();
 
 		void encodeSibByte();
 	};
@@ -1,10 +1,16 @@
 #include "CodeGenerator.hpp"
+#include "CPUID.hpp"
 
 #include <stdio.h>
+#include <string.h>
 
 #ifdef WIN32
 	#include <conio.h>
+	#include <direct.h>
+	#include <io.h>
 #else
+	#include <sys/stat.h>
+	#include <dirent.h>
 	inline int getch() {return fgetc(stdin);}
 #endif
 
@@ -132,27 +138,16 @@ void testAlphaBlend()
 	getch();
 	printf("Assembling AlphaBlend.asm...\n\n");
 
-	bool katmai;
-
-	printf("Do you have a Katmai compatible processor (y/n)?\n\n");
-
-	int c;
-	do
+	// The katmai symbol is defined from CPUID
+	if(CPUID::supports(CPUID::MMXEXT))
 	{
-		c = getch();
-	}
-	while(c != 'y' && c != 'n');
-
-	if(c == 'y')
-	{
-		katmai = true;
+		printf("Katmai compatible processor detected\n\n");
 	}
 	else
 	{
-		katmai = false;
+		printf("No Katmai compatible processor detected\n\n");
 	}
 
-	ASM_DEFINE(katmai);
 	Assembler x86("AlphaBlend.asm");
 
 	int (*alphaBlend)(int, int, int) = (int(*)(int, int, int))x86.callable();
@@ -396,6 +391,264 @@ void testRegisterAllocator()
 	}
 }
 
+static int calls = 0;
+
+static void countCall()
+{
+	calls++;
+}
+
+class TestRecordedLoop : public CodeGenerator
+{
+public:
+	TestRecordedLoop()
+	{
+		for(int i = 0; i < 8; i++)
+		{
+			x[i] = i;
+		}
+
+		sum = 0;
+		counter = 10;
+		words[0] = 1; words[1] = 2; words[2] = 3; words[3] = 4;
+		step[0] = 1; step[1] = 10; step[2] = 100; step[3] = 1000;
+		total = 0.0f;
+		one = 1.0f;
+
+		prologue();
+		beginRecording();
+
+		label("loop");
+
+		// Nine values live in the loop, more than the six general-purpose registers
+		for(int i = 0; i < 8; i++)
+		{
+			add(r32(&x[i]), i + 1);
+			add(r32(&sum), r32(&x[i]));
+		}
+
+		call((int)countCall);
+
+		paddw(r64(words), m64(step));
+
+		// Needs an emms after the MMX block
+		fld(dword_ptr [&total]);
+		fadd(dword_ptr [&one]);
+		fstp(dword_ptr [&total]);
+
+		dec(r32(&counter));
+		jnz("loop");
+
+		endRecording();
+		epilogue();
+		ret();
+	}
+
+	bool check() const
+	{
+		int expected = 0;
+
+		for(int k = 1; k <= 10; k++)
+		{
+			for(int i = 0; i < 8; i++)
+			{
+				expected += i + k * (i + 1);
+			}
+		}
+
+		for(int i = 0; i < 8; i++)
+		{
+			if(x[i] != i + 10 * (i + 1)) return false;
+		}
+
+		return sum == expected && counter == 0 && calls == 10 &&
+		       words[0] == 11 && words[1] == 102 && words[2] == 1003 && words[3] == 10004 &&
+		       total == 10.0f;
+	}
+
+	int x[8];
+	int sum;
+	int counter;
+	short words[4];
+	short step[4];
+	float total;
+	float one;
+};
+
+void testRecordedLoop()
+{
+	printf("Testing recorded register allocation. A loop with more values than registers, a call, and MMX code followed by x87 code.\n\n");
+	printf("Press any key to start assembling\n\n");
+	getch();
+
+	TestRecordedLoop x86;
+
+	void (*script)() = (void(*)())x86.callable();
+
+	if(script)
+	{
+		printf("%s\n\n", x86.getListing());
+		printf("Execute code (y/n)?\n\n");
+
+		int c;
+		do
+		{
+			c = getch();
+		}
+		while(c != 'y' && c != 'n');
+
+		if(c == 'y')
+		{
+			script();
+			printf("output: sum %d, calls %d, words %d %d %d %d, total %g\n", x86.sum, calls, x86.words[0], x86.words[1], x86.words[2], x86.words[3], x86.total);
+			printf("%s\n\n", x86.check() ? "Correct" : "Wrong");
+		}
+	}
+	else
+	{
+		printf(x86.getErrors());
+	}
+}
+
+static void clearCache(const char *directory)   // Creates the directory or removes precompiled files left in it
+{
+	char fileName[1024];
+
+	#ifdef WIN32
+		_mkdir(directory);
+
+		sprintf(fileName, "%s/*.sw?", directory);
+		_finddata_t file;
+		intptr_t search = _findfirst(fileName, &file);
+
+		if(search != -1)
+		{
+			do
+			{
+				sprintf(fileName, "%s/%s", directory, file.name);
+				remove(fileName);
+			}
+			while(_findnext(search, &file) == 0);
+
+			_findclose(search);
+		}
+	#else
+		mkdir(directory, 0777);
+
+		DIR *list = opendir(directory);
+
+		if(list)
+		{
+			while(const dirent *file = readdir(list))
+			{
+				const char *extension = strrchr(file->d_name, '.');
+
+				if(extension && (strcmp(extension, ".swo") == 0 || strcmp(extension, ".swc") == 0))
+				{
+					sprintf(fileName, "%s/%s", directory, file->d_name);
+					remove(fileName);
+				}
+			}
+
+			closedir(list);
+		}
+	#endif
+}
+
+void testPrecompiled()
+{
+	printf("Cached is a function which sums the first n entries of a table and calls countCall. It is assembled into a cache directory, then loaded back from the .swo encodings and from the .swc image.\n\n");
+	printf("Press any key to start assembling\n\n");
+	getch();
+	printf("Assembling Cached.asm...\n\n");
+
+	ASM_EXPORT(countCall);
+	clearCache("Cache");
+	Assembler::setCacheDirectory("Cache");
+
+	// The first writes the .swo, the second loads it and writes the .swc, the third loads that
+	Assembler assembled("Cached.asm");
+	Assembler encodings("Cached.asm");
+	encodings.callable();
+	Assembler image("Cached.asm");
+
+	Assembler::setCacheDirectory(0);
+
+	Assembler *x86[] = {&assembled, &encodings, &image};
+	const char *labels[] = {"Table", "Cached", "Absolute", "Sum", "Relative", "Finish"};
+	const unsigned char *address[3][6];
+
+	for(int i = 0; i < 3; i++)
+	{
+		for(int j = 0; j < 6; j++)
+		{
+			address[i][j] = (const unsigned char*)x86[i]->callable(labels[j]);
+
+			if(!address[i][j])
+			{
+				printf(x86[i]->getErrors());
+				return;
+			}
+		}
+	}
+
+	printf("%s\n\n", assembled.getListing());
+
+	// Identical apart from the relocated fields, which have to point at this copy's table and at countCall
+	bool correct = true;
+
+	for(int i = 0; i < 3; i++)
+	{
+		const unsigned char *code = address[i][0];
+		const int absolute = address[i][2] + 1 - code;   // mov ecx, Table
+		const int relative = address[i][4] + 1 - code;   // call countCall
+		int field;
+
+		for(int j = 0; j < 6; j++)
+		{
+			correct = correct && address[i][j] - code == address[0][j] - address[0][0];
+		}
+
+		for(int k = 0; correct && k < address[i][5] - code; k++)
+		{
+			if(!(k >= absolute && k < absolute + 4) && !(k >= relative && k < relative + 4))
+			{
+				correct = code[k] == address[0][0][k];
+			}
+		}
+
+		memcpy(&field, code + absolute, 4);
+		correct = correct && field == (int)code;
+
+		memcpy(&field, code + relative, 4);
+		correct = correct && field == (int)countCall - (int)(code + relative + 4);
+	}
+
+	printf("%s\n\n", correct ? "Correct" : "Wrong");
+	printf("Execute code (y/n)?\n\n");
+
+	int c;
+	do
+	{
+		c = getch();
+	}
+	while(c != 'y' && c != 'n');
+
+	if(c == 'y')
+	{
+		calls = 0;
+
+		for(int i = 0; i < 3; i++)
+		{
+			int (*cached)(int) = (int(*)(int))address[i][1];
+
+			printf("output: %d\n", cached(4));
+		}
+
+		printf("calls %d\n\n", calls);
+	}
+}
+
 int main()
 {
 	testHelloWorld();
@@ -406,6 +659,8 @@ int main()
 	testMandelbrot();
 	testIntrinsics();
 	testRegisterAllocator();
+	testRecordedLoop();
+	testPrecompiled();
 
 	printf("Press any key to continue\n");
 	getch();
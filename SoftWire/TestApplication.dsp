@@ -120,6 +120,10 @@ SOURCE=.\AlphaBlend.asm
 # End Source File
 # Begin Source File
 
+SOURCE=.\Cached.asm
+# End Source File
+# Begin Source File
+
 SOURCE=.\CrossProduct.asm
 # End Source File
 # Begin Source File
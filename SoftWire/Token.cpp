@@ -2,243 +2,176 @@
 
 #include "String.hpp"
 #include "Error.hpp"
-
-#include <stdlib.h>
+#include "Mutex.hpp"
 
 namespace SoftWire
 {
-	Token::Token()
-	{
-	}
-
-	Token::~Token()
-	{
-	}
-
-	bool Token::isEndOfLine() const
-	{
-		return false;
-	}
-
-	bool Token::isEndOfFile() const
-	{
-		return false;
-	}
-
-	bool Token::isIdentifier(const char *compareString) const
-	{
-		return false;
-	}
+	Token::Entry *volatile Token::table[tableSize];
+	int Token::references = 0;
+	Mutex Token::mutex;
 
-	bool Token::isInteger() const
+	Token::Token()
 	{
-		return false;
+		type = END_OF_FILE;
+		string = "";
 	}
 
-	bool Token::isReal() const
+	const char *Token::intern(const char *string)
 	{
-		return false;
+		return intern(string, strlen(string));
 	}
 
-	bool Token::isPunctuator(char c) const
+	const char *Token::intern(const char *string, int length)
 	{
-		return false;
-	}
+		// Identifiers repeat a lot, so every distinct string is stored only once
+		unsigned int hash = 2166136261u;
 
-	bool Token::isLiteral() const
-	{
-		return false;
-	}
+		for(int i = 0; i < length; i++)
+		{
+			hash = (hash ^ (unsigned char)string[i]) * 16777619u;
+		}
 
-	bool Token::isConstant() const
-	{
-		return false;
-	}
+		Entry *volatile &bucket = table[hash % tableSize];
+		const Entry *first = published(bucket);
 
-	const char *Token::getString() const
-	{
-		return "";
-	}
+		// Published entries never change, so strings seen before are found without locking
+		const char *interned = find(first, 0, string, length, hash);
 
-	char Token::getChar() const
-	{
-		return '\0';
-	}
+		if(interned)
+		{
+			return interned;
+		}
 
-	int Token::getInteger() const
-	{
-		return 0;
-	}
+		Lock lock(mutex);
 
-	float Token::getReal() const
-	{
-		return 0.0f;
-	}
+		interned = find(bucket, first, string, length, hash);   // Added by another thread meanwhile
 
-	Token *Token::copy(const Token *token)
-	{
-		if(token->isEndOfFile())	return new EndOfFile(token->getString());
-		if(token->isEndOfLine())	return new EndOfLine(token->getString());
-		if(token->isIdentifier())	return new Identifier(token->getString());
-		if(token->isInteger())		return new Integer(token->getInteger());
-		if(token->isLiteral())		return new Literal(token->getString());
-		if(token->isPunctuator())	return new Punctuator(token->getChar());
-		if(token->isReal())			return new Real(token->getReal());
-		else						throw INTERNAL_ERROR;
-	}
+		if(interned)
+		{
+			return interned;
+		}
 
-	EndOfLine::EndOfLine(const char *lineStart)
-	{
-		this->lineStart = lineStart;
-	}
+		Entry *entry = new Entry;
+		entry->string = new char[length + 1];
+		memcpy(entry->string, string, length);
+		entry->string[length] = '\0';
+		entry->length = length;
+		entry->hash = hash;
+		entry->next = bucket;
+		publish(bucket, entry);
 
-	bool EndOfLine::isEndOfLine() const
-	{
-		return true;
+		return entry->string;
 	}
 
-	const char *EndOfLine::getString() const
+	void Token::acquireStrings()
 	{
-		return lineStart;
-	}
+		Lock lock(mutex);
 
-	EndOfFile::EndOfFile(const char *lineStart)
-	{
-		this->lineStart = lineStart;
+		references++;
 	}
 
-	bool EndOfFile::isEndOfFile() const
+	void Token::releaseStrings()
 	{
-		return true;
-	}
+		Lock lock(mutex);
 
-	bool EndOfFile::isEndOfLine() const
-	{
-		return true;
-	}
+		references--;
 
-	const char *EndOfFile::getString() const
-	{
-		return lineStart;
-	}
+		if(references > 0)
+		{
+			return;
+		}
 
-	Identifier::Identifier(const char *string)
-	{
-		this->string = strdup(string);
-	}
+		for(int i = 0; i < tableSize; i++)
+		{
+			while(table[i])
+			{
+				Entry *next = table[i]->next;
+				delete[] table[i]->string;
+				delete table[i];
+				table[i] = next;
+			}
+		}
 
-	Identifier::~Identifier()
-	{
-		delete[] string;
+		references = 0;
 	}
 
-	bool Identifier::isIdentifier(const char *compareString) const
+	const char *Token::find(const Entry *entry, const Entry *last, const char *string, int length, unsigned int hash)
 	{
-		if(!compareString)
-		{
-			return true;
-		}
-		else
+		for(; entry != last; entry = entry->next)
 		{
-			if(strcmp(this->string, compareString) == 0)
+			if(entry->hash == hash && entry->length == length && memcmp(entry->string, string, length) == 0)
 			{
-				return true;
-			}
-			else
-			{
-				return false;
+				return entry->string;
 			}
 		}
-	}
 
-	const char *Identifier::getString() const
-	{
-		return string;
+		return 0;
 	}
 
-	Integer::Integer(int value)
+	const Token::Entry *Token::published(Entry *volatile &bucket)
 	{
-		this->value = value;
+		#ifdef __GNUC__
+			return __atomic_load_n(&bucket, __ATOMIC_ACQUIRE);
+		#else
+			return bucket;   // Volatile reads acquire on Visual C++
+		#endif
 	}
 
-	bool Integer::isInteger() const
+	void Token::publish(Entry *volatile &bucket, Entry *entry)
 	{
-		return true;
+		// The entry has to be complete before lookups without the mutex can reach it
+		#ifdef __GNUC__
+			__atomic_store_n(&bucket, entry, __ATOMIC_RELEASE);
+		#else
+			bucket = entry;   // Volatile writes release on Visual C++
+		#endif
 	}
 
-	bool Integer::isConstant() const
+	EndOfLine::EndOfLine(const char *lineStart)
 	{
-		return true;
+		type = END_OF_LINE;
+		string = lineStart;
 	}
 
-	int Integer::getInteger() const
+	EndOfFile::EndOfFile(const char *lineStart)
 	{
-		return value;
+		type = END_OF_FILE;
+		string = lineStart;
 	}
 
-	Real::Real(float value)
+	Identifier::Identifier(const char *string)
 	{
-		this->value = value;
+		type = IDENTIFIER;
+		this->string = intern(string);
 	}
 
-	bool Real::isReal() const
+	Identifier::Identifier(const char *string, int length)
 	{
-		return true;
+		type = IDENTIFIER;
+		this->string = intern(string, length);
 	}
 
-	bool Real::isConstant() const
+	Integer::Integer(int value)
 	{
-		return true;
+		type = INTEGER;
+		integer = value;
 	}
 
-	float Real::getReal() const
+	Real::Real(float value)
 	{
-		return value;
+		type = REAL;
+		real = value;
 	}
 
 	Punctuator::Punctuator(char c)
 	{
+		type = PUNCTUATOR;
 		this->c = c;
 	}
 
-	bool Punctuator::isPunctuator(char c) const
-	{
-		if(c == 0)
-		{
-			return true;
-		}
-		else if(this->c == c)
-		{
-			return true;
-		}
-		else
-		{
-			return false;
-		}
-	}
-
-	char Punctuator::getChar() const
-	{
-		return c;
-	}
-
 	Literal::Literal(const char *string)
 	{
-		this->string = strdup(string);
-	}
-
-	Literal::~Literal()
-	{
-		delete[] string;
-	}
-
-	bool Literal::isLiteral() const
-	{
-		return true;
-	}
-
-	const char *Literal::getString() const
-	{
-		return string;
+		type = LITERAL;
+		this->string = intern(string);
 	}
 }
@@ -1,129 +1,188 @@
 #ifndef SoftWire_Token_hpp
 #define SoftWire_Token_hpp
 
+#include "String.hpp"
+#include "Mutex.hpp"
+
 namespace SoftWire
 {
-	class Scanner;
-
 	class Token
 	{
 	public:
+		enum Type
+		{
+			END_OF_LINE,
+			END_OF_FILE,
+			IDENTIFIER,
+			INTEGER,
+			REAL,
+			PUNCTUATOR,
+			LITERAL
+		};
+
 		Token();
 
-		virtual ~Token();
+		bool isEndOfLine() const;
+		bool isEndOfFile() const;
+		bool isIdentifier(const char *compareString = 0) const;
+		bool isInteger() const;
+		bool isReal() const;
+		bool isPunctuator(char c = 0) const;
+		bool isLiteral() const;
+		bool isConstant() const;
+
+		const char *getString() const;
+		char getChar() const;
+		int getInteger() const;
+		float getReal() const;
+
+		static const char *intern(const char *string);   // Equal strings share one pointer
+		static const char *intern(const char *string, int length);
+		static void acquireStrings();   // Interned strings are freed when the last holder releases them
+		static void releaseStrings();
 
-		virtual bool isEndOfLine() const;
-		virtual bool isEndOfFile() const;
-		virtual bool isIdentifier(const char *compareString = 0) const;
-		virtual bool isInteger() const;
-		virtual bool isReal() const;
-		virtual bool isPunctuator(char c = 0) const;
-		virtual bool isLiteral() const;
-		virtual bool isConstant() const;
+	protected:
+		Type type;
 
-		virtual const char *getString() const;
-		virtual char getChar() const;
-		virtual int getInteger() const;
-		virtual float getReal() const;
+		union
+		{
+			const char *string;   // Interned, or line start for end-of-line
+			int integer;
+			float real;
+			char c;
+		};
 
-		static Token *copy(const Token *token);
+	private:
+		struct Entry
+		{
+			char *string;
+			int length;
+			unsigned int hash;
+			Entry *next;
+		};
+
+		enum {tableSize = 4096};
+		static Entry *volatile table[tableSize];   // Lookups read it without the mutex
+		static int references;
+		static Mutex mutex;
+
+		static const char *find(const Entry *entry, const Entry *last, const char *string, int length, unsigned int hash);
+		static const Entry *published(Entry *volatile &bucket);
+		static void publish(Entry *volatile &bucket, Entry *entry);
 	};
 
+	// Tokens are compact tagged records, these only set the tag and value
+
 	class EndOfLine : public Token
 	{
 	public:
 		EndOfLine(const char *lineStart);
-
-		bool isEndOfLine() const;
-		const char *getString() const;
-
-	private:
-		const char *lineStart;
 	};
 
 	class EndOfFile : public Token
 	{
 	public:
 		EndOfFile(const char *lineStart);
-
-		bool isEndOfFile() const;
-		bool isEndOfLine() const;
-		const char *getString() const;
-
-	private:
-		const char *lineStart;
 	};
 
 	class Identifier : public Token
 	{
 	public:
 		Identifier(const char *string);
-
-		~Identifier();
-
-		bool isIdentifier(const char *compareString = 0) const;
-
-		const char *getString() const;
-
-	private:
-		char *string;
+		Identifier(const char *string, int length);   // Interned from a slice of the source, which needs no terminator
 	};
 
 	class Integer : public Token
 	{
 	public:
 		Integer(int value);
-
-		bool isInteger() const;
-		bool isConstant() const;
-
-		int getInteger() const;
-
-	private:
-		int value;
 	};
 
 	class Real : public Token
 	{
 	public:
 		Real(float value);
-
-		bool isReal() const;
-		bool isConstant() const;
-
-		float getReal() const;
-
-	private:
-		float value;
 	};
 
 	class Punctuator : public Token
 	{
 	public:
 		Punctuator(char c);
-
-		bool isPunctuator(char c = 0) const;
-
-		char getChar() const;
-
-	private:
-		char c;
 	};
 
 	class Literal : public Token
 	{
 	public:
 		Literal(const char *string);
+	};
+}
 
-		~Literal();
+namespace SoftWire
+{
+	inline bool Token::isEndOfLine() const
+	{
+		return type == END_OF_LINE || type == END_OF_FILE;
+	}
 
-		bool isLiteral() const;
+	inline bool Token::isEndOfFile() const
+	{
+		return type == END_OF_FILE;
+	}
 
-		const char *getString() const;
+	inline bool Token::isIdentifier(const char *compareString) const
+	{
+		if(type != IDENTIFIER)
+		{
+			return false;
+		}
 
-	private:
-		char *string;
-	};
+		return !compareString || string == compareString || strcmp(string, compareString) == 0;
+	}
+
+	inline bool Token::isInteger() const
+	{
+		return type == INTEGER;
+	}
+
+	inline bool Token::isReal() const
+	{
+		return type == REAL;
+	}
+
+	inline bool Token::isPunctuator(char c) const
+	{
+		return type == PUNCTUATOR && (c == 0 || this->c == c);
+	}
+
+	inline bool Token::isLiteral() const
+	{
+		return type == LITERAL;
+	}
+
+	inline bool Token::isConstant() const
+	{
+		return type == INTEGER || type == REAL;
+	}
+
+	inline const char *Token::getString() const
+	{
+		return (type == IDENTIFIER || type == LITERAL || type == END_OF_LINE || type == END_OF_FILE) ? string : "";
+	}
+
+	inline char Token::getChar() const
+	{
+		return type == PUNCTUATOR ? c : '\0';
+	}
+
+	inline int Token::getInteger() const
+	{
+		return type == INTEGER ? integer : 0;
+	}
+
+	inline float Token::getReal() const
+	{
+		return type == REAL ? real : 0.0f;
+	}
 }
 
 #endif   // SoftWire_Token_hpp
@@ -5,396 +5,292 @@
 #include "Error.hpp"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 namespace SoftWire
 {
-	TokenList::TokenLink::TokenLink()
-	{
-		token = 0;
-		next = 0;
-	}
+	const Token TokenList::none;
 
-	TokenList::TokenLink::~TokenLink()
+	TokenList::TokenList()
 	{
-		delete token;
-		token = 0;
+		capacity = 256;
+		tokens = (Token*)malloc(capacity * sizeof(Token));   // Plain records, left unconstructed
 
-		delete next;
-		next = 0;
-	}
+		if(!tokens) throw Error("Out of memory for tokens");
 
-	TokenList::TokenList()
-	{
-		head = new TokenLink();
-		pointer = head;
+		gapStart = 0;
+		gapEnd = capacity;
+		end = capacity;
 	}
 
 	TokenList::~TokenList()
 	{
-		delete head;
-		head = 0;
+		free(tokens);
+		tokens = 0;
+	}
 
-		pointer = 0;
+	inline const Token &TokenList::token() const
+	{
+		return gapEnd < end ? tokens[gapEnd] : none;
 	}
 
 	bool TokenList::isEndOfFile() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return true;
-		}
-
-		return pointer->token->isEndOfFile();
+		return token().isEndOfFile();
 	}
 
 	bool TokenList::isEndOfLine() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return true;
-		}
-
-		return pointer->token->isEndOfLine();
+		return token().isEndOfLine();
 	}
 
 	bool TokenList::isIdentifier(const char *compareString) const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isIdentifier(compareString);
+		return token().isIdentifier(compareString);
 	}
 
 	bool TokenList::isInteger() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isInteger();
+		return token().isInteger();
 	}
 
 	bool TokenList::isReal() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isReal();
+		return token().isReal();
 	}
 
 	bool TokenList::isPunctuator(char c) const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isPunctuator(c);
+		return token().isPunctuator(c);
 	}
 
 	bool TokenList::isLiteral() const
 	{
-		if(!pointer || !pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isLiteral();
+		return token().isLiteral();
 	}
 
 	bool TokenList::isConstant() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return false;
-		}
-
-		return pointer->token->isConstant();
+		return token().isConstant();
 	}
 
 	const char *TokenList::getString() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return "";
-		}
-
-		return pointer->token->getString();
+		return token().getString();
 	}
 
 	char TokenList::getChar() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return '\0';
-		}
-
-		return pointer->token->getChar();
+		return token().getChar();
 	}
 
 	int TokenList::getInteger() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return 0;
-		}
-
-		return pointer->token->getInteger();
+		return token().getInteger();
 	}
 
 	float TokenList::getReal() const
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		if(!pointer->token)
-		{
-			return 0;
-		}
-
-		return pointer->token->getReal();
+		return token().getReal();
 	}
 
 	const Token &TokenList::current() const
 	{
-		if(!pointer || !pointer->token)
+		if(gapEnd >= end)
 		{
 			throw INTERNAL_ERROR;
 		}
 
-		return *pointer->token;
+		return tokens[gapEnd];
 	}
 
 	const Token &TokenList::lookAhead(int n) const
 	{
-		if(!pointer)
+		if(gapEnd + n >= end)
 		{
 			throw INTERNAL_ERROR;
 		}
 
-		TokenLink *lookAhead = pointer;
+		return tokens[gapEnd + n];
+	}
 
-		while(lookAhead->next && n--)
+	const Token &TokenList::advance(int n)
+	{
+		if(n > end - gapEnd)
 		{
-			lookAhead = lookAhead->next;
+			n = end - gapEnd;
 		}
 
-		if(!lookAhead->token)
+		if(gapStart != gapEnd)
 		{
-			throw INTERNAL_ERROR;
+			memmove(&tokens[gapStart], &tokens[gapEnd], n * sizeof(Token));
 		}
 
-		return *lookAhead->token;
+		gapStart += n;
+		gapEnd += n;
+
+		return token();
 	}
 
-	const Token &TokenList::advance(int n)
+	void TokenList::append(const Token &token)
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
+		const Token copy = token;   // Might reference this buffer
 
-		while(pointer->next && n--)
+		if(end == capacity)
 		{
-			pointer = pointer->next;
+			grow();
 		}
 
-		return *pointer->token;
+		tokens[end++] = copy;
 	}
 
-	void TokenList::append(const Token &token)
+	void TokenList::erase(int n)
 	{
-		if(!pointer)
+		if(n > end - gapEnd)
 		{
-			throw INTERNAL_ERROR;
+			n = end - gapEnd;
 		}
 
-		TokenLink *link = pointer;
+		gapEnd += n;
+	}
 
-		while(link->next && link->token)
+	void TokenList::overwrite(const Token &token)
+	{
+		if(gapEnd == end)
+		{
+			append(token);
+		}
+		else
 		{
-			link = link->next;
+			tokens[gapEnd] = token;
 		}
+	}
 
-		link->token = Token::copy(&token);
+	void TokenList::insertBefore(const Token &token)
+	{
+		const Token copy = token;
 
-		if(link->next)
+		if(gapStart == gapEnd)
 		{
-			throw INTERNAL_ERROR;
+			grow();
 		}
 
-		link->next = new TokenLink();
+		tokens[--gapEnd] = copy;
 	}
 
-	void TokenList::erase(int n)
+	void TokenList::insertAfter(const Token &token)
 	{
-		if(!pointer)
+		if(gapEnd == end)
 		{
-			throw INTERNAL_ERROR;
+			append(token);
 		}
-
-		while(n--)
+		else
 		{
-			TokenLink *old = pointer->next;
-			delete pointer->token;
-
-			if(pointer->next)
-			{
-				pointer->token = pointer->next->token;
-				pointer->next = pointer->next->next;
-			}
-
-			if(old)
-			{
-				old->token = 0;
-				old->next = 0;
-				delete old;
-			}
+			advance();
+			insertBefore(token);
 		}
 	}
 
-	void TokenList::overwrite(const Token &token)
+	void TokenList::paste(const TokenList &tokenList)
 	{
-		if(!pointer)
+		const int n = tokenList.gapStart + tokenList.end - tokenList.gapEnd;
+
+		advance();
+		reserve(n + 1);
+
+		for(int i = 0; i < n; i++)
 		{
-			throw INTERNAL_ERROR;
+			const Token &token = i < tokenList.gapStart ? tokenList.tokens[i] : tokenList.tokens[tokenList.gapEnd + i - tokenList.gapStart];
+
+			if(token.isEndOfFile())
+			{
+				break;
+			}
+
+			tokens[gapStart++] = token;
 		}
 
-		delete pointer->token;
-		pointer->token = Token::copy(&token);
+		tokens[--gapEnd] = EndOfLine(gapStart > 0 ? tokens[gapStart - 1].getString() : "");
 	}
 
-	void TokenList::insertBefore(const Token &token)
+	int TokenList::expand(Macro &macro)
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
+		const int position = gapStart;
 
-		TokenLink *oldLink = pointer->next;
-		Token *oldToken = pointer->token;
+		const int inserted = macro.expand(*this);
 
-		pointer->token = Token::copy(&token);
-		pointer->next = new TokenLink;
+		seek(position);
 
-		pointer->next->token = oldToken;
-		pointer->next->next = oldLink;
+		return inserted;
 	}
 
-	void TokenList::insertAfter(const Token &token)
+	void TokenList::rewind()
 	{
-		if(!pointer)
-		{
-			throw INTERNAL_ERROR;
-		}
-
-		TokenLink *oldLink = pointer->next;
-		pointer->next = new TokenLink;
-		pointer = pointer->next;
-
-		pointer->token = Token::copy(&token);
-		pointer->next = oldLink;
+		seek(0);
 	}
 
-	void TokenList::paste(TokenList &tokenList)
+	bool TokenList::isEmpty() const
 	{
-		while(!tokenList.isEndOfFile())
+		if(gapStart > 0)
 		{
-			insertAfter(tokenList.current());
-			tokenList.advance();
+			return tokens[0].isEndOfFile();
 		}
 
-		insertAfter(EndOfLine(getString()));
+		return token().isEndOfFile();
 	}
 
-	void TokenList::expand(Macro &macro)
+	int TokenList::position() const
 	{
-		TokenLink *originalPosition = pointer;
-
-		macro.expandAll(*this);
+		return gapStart;
+	}
 
-		pointer = originalPosition;
+	int TokenList::size() const
+	{
+		return gapStart + end - gapEnd;
 	}
 
-	void TokenList::rewind()
+	void TokenList::seek(int position)
 	{
-		if(!head)
+		if(position < gapStart)
 		{
-			throw INTERNAL_ERROR;
-		}
+			const int n = gapStart - position;
 
-		pointer = head;
-	}
+			gapStart -= n;
+			gapEnd -= n;
 
-	bool TokenList::isEmpty() const
-	{
-		if(!head)
+			memmove(&tokens[gapEnd], &tokens[gapStart], n * sizeof(Token));
+		}
+		else if(position > gapStart)
 		{
-			throw INTERNAL_ERROR;
+			advance(position - gapStart);
 		}
+	}
 
-		if(!head->token)
+	void TokenList::reserve(int n)
+	{
+		while(gapEnd - gapStart < n)
 		{
-			return true;
+			grow();
 		}
+	}
+
+	void TokenList::grow()
+	{
+		// Double the capacity, half of the new space goes to the gap
+		const int extra = capacity;
+		Token *buffer = (Token*)malloc((capacity + extra) * sizeof(Token));
+
+		if(!buffer) throw Error("Out of memory for tokens");   // Leaves the list as it was
+
+		memcpy(buffer, tokens, gapStart * sizeof(Token));
+		memcpy(&buffer[gapEnd + extra / 2], &tokens[gapEnd], (end - gapEnd) * sizeof(Token));
+
+		free(tokens);
+		tokens = buffer;
 
-		return head->token->isEndOfFile();
+		gapEnd += extra / 2;
+		end += extra / 2;
+		capacity += extra;
 	}
 }
@@ -1,10 +1,11 @@
 #ifndef SoftWire_TokenList_hpp
 #define SoftWire_TokenList_hpp
 
+#include "Token.hpp"
+
 namespace SoftWire
 {
 	class Macro;
-	class Token;
 
 	class TokenList
 	{
@@ -38,26 +39,28 @@ namespace SoftWire
 		void insertBefore(const Token &token);
 		void insertAfter(const Token &token);
 
-		void paste(TokenList &tokenList);
-		void expand(Macro &macro);
+		void paste(const TokenList &tokenList);
+		int expand(Macro &macro);   // Leaves the current token at the start of the expansion
 
 		void rewind();
 		bool isEmpty() const;
+		int position() const;
+		int size() const;
+		void seek(int position);
 
 	private:
-		class TokenLink
-		{
-		public:
-			TokenLink();
-
-			~TokenLink();
+		// Gap buffer, the current token directly follows the gap
+		Token *tokens;
+		int capacity;
+		int gapStart;
+		int gapEnd;
+		int end;
 
-			Token *token;
-			TokenLink *next;
-		};
+		static const Token none;   // Past the end
 
-		TokenLink *head;
-		TokenLink *pointer;
+		const Token &token() const;
+		void reserve(int n);
+		void grow();
 	};
 }
 
@@ -0,0 +1,507 @@
+#include "Scanner.hpp"
+#include "Parser.hpp"
+#include "Synthesizer.hpp"
+#include "InstructionSet.hpp"
+#include "Instruction.hpp"
+#include "Encoding.hpp"
+#include "Error.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+using namespace SoftWire;
+
+// Encodes every instruction set entry with sample operands and compares the bytes with the GNU assembler
+
+const int MAX_SAMPLES = 8;
+const int SLOT = 16;   // Bytes per instruction in the file given to objdump
+
+bool testable(const Instruction *instruction)
+{
+	const char *encoding = instruction->getEncoding();
+
+	if(strstr(encoding, "p1"))   // Data
+	{
+		return false;
+	}
+
+	if(strstr(encoding, "-b") || strstr(encoding, "-i"))   // Relative to the instruction address
+	{
+		return false;
+	}
+
+	const char *space = strchr(instruction->getMnemonic(), ' ');
+
+	if(space && strncmp(instruction->getMnemonic(), "LOCK ", 5) != 0)   // Repeat prefixes are only available as intrinsics
+	{
+		return false;
+	}
+
+	if(instruction->getFirstOperand() == Operand::STR || instruction->getSecondOperand() == Operand::STR)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int operandSamples(Operand::Type type, char sample[MAX_SAMPLES][64])
+{
+	static const char *memory[] = {"[ebx]", "[ebp]", "[esp+8]", "[eax+ecx*4+1024]"};
+
+	int n = 0;
+
+	switch(type)
+	{
+	case Operand::VOID:		return 0;
+	case Operand::ONE:		strcpy(sample[n++], "1");			return n;
+	case Operand::IMM8:		strcpy(sample[n++], "12");			return n;
+	case Operand::IMM16:	strcpy(sample[n++], "1234");		return n;
+	case Operand::IMM:		strcpy(sample[n++], "100");			strcpy(sample[n++], "1000");	return n;
+	default:				break;
+	}
+
+	switch(type & Operand::REG)
+	{
+	case Operand::AL:		strcpy(sample[n++], "al");		break;
+	case Operand::CL:		strcpy(sample[n++], "cl");		break;
+	case Operand::AX:		strcpy(sample[n++], "ax");		break;
+	case Operand::CX:		strcpy(sample[n++], "cx");		break;
+	case Operand::DX:		strcpy(sample[n++], "dx");		break;
+	case Operand::EAX:		strcpy(sample[n++], "eax");		break;
+	case Operand::ECX:		strcpy(sample[n++], "ecx");		break;
+	case Operand::ST0:		strcpy(sample[n++], "st0");		break;
+	case Operand::REG8:		strcpy(sample[n++], "dl");		strcpy(sample[n++], "bh");		break;
+	case Operand::REG16:	strcpy(sample[n++], "si");		break;
+	case Operand::REG32:	strcpy(sample[n++], "edx");		strcpy(sample[n++], "ebp");		break;
+	case Operand::FPUREG:	strcpy(sample[n++], "st3");		break;
+	case Operand::MMREG:	strcpy(sample[n++], "mm5");		break;
+	case Operand::XMMREG:	strcpy(sample[n++], "xmm6");	break;
+	default:				break;
+	}
+
+	const char *size = "";
+
+	switch(type & Operand::MEM)
+	{
+	case 0:					return n;
+	case Operand::MEM8:		size = "byte ptr ";		break;
+	case Operand::MEM16:	size = "word ptr ";		break;
+	case Operand::MEM32:	size = "dword ptr ";	break;
+	case Operand::MEM64:	size = "qword ptr ";	break;
+	case Operand::MEM128:	size = "xmmword ptr ";	break;
+	default:				break;   // Unsized memory
+	}
+
+	for(unsigned int i = 0; i < sizeof(memory) / sizeof(memory[0]); i++)
+	{
+		sprintf(sample[n++], "%s%s", size, memory[i]);
+	}
+
+	return n;
+}
+
+void gasSyntax(char *output, const char *line)
+{
+	const char *start = line;
+
+	// Floating-point stack registers are written st(i)
+	while(*line)
+	{
+		if(line[0] == 's' && line[1] == 't' && isdigit(line[2]) && !isalnum(line[3]) && (line == start || !isalnum(line[-1])))
+		{
+			output += sprintf(output, "st(%c)", line[2]);
+			line += 3;
+		}
+		else
+		{
+			*output++ = *line++;
+		}
+	}
+
+	*output = '\0';
+}
+
+int generateSource(InstructionSet &instructionSet, FILE *source, FILE *gas, int &skipped)
+{
+	int lines = 0;
+
+	fprintf(gas, ".intel_syntax noprefix\n");
+
+	for(int i = 0; i < InstructionSet::numInstructions(); i++)
+	{
+		const Instruction *instruction = instructionSet.instruction(i);
+
+		if(!testable(instruction))
+		{
+			skipped++;
+			continue;
+		}
+
+		char mnemonic[32];
+		int m = 0;
+
+		for(; instruction->getMnemonic()[m] && m < 31; m++)
+		{
+			mnemonic[m] = tolower(instruction->getMnemonic()[m]);
+		}
+
+		mnemonic[m] = '\0';
+
+		char first[MAX_SAMPLES][64];
+		char second[MAX_SAMPLES][64];
+		char third[MAX_SAMPLES][64];
+
+		int n1 = operandSamples(instruction->getFirstOperand(), first);
+		int n2 = operandSamples(instruction->getSecondOperand(), second);
+		int n3 = operandSamples(instruction->getThirdOperand(), third);
+
+		for(int a = 0; a < (n1 ? n1 : 1); a++)
+		for(int b = 0; b < (n2 ? n2 : 1); b++)
+		for(int c = 0; c < (n3 ? n3 : 1); c++)
+		{
+			char line[256];
+			char *text = line + sprintf(line, "%s", mnemonic);
+
+			if(n1) text += sprintf(text, " %s", first[a]);
+			if(n2) text += sprintf(text, ", %s", second[b]);
+			if(n3) text += sprintf(text, ", %s", third[c]);
+
+			char gasLine[256];
+			gasSyntax(gasLine, line);
+
+			fprintf(source, "%s\n", line);
+			fprintf(gas, "%s\n", gasLine);
+			lines++;
+		}
+	}
+
+	return lines;
+}
+
+void readListing(FILE *listing, unsigned char (*gasCode)[16], int *gasLength, int lines)
+{
+	char buffer[1024];
+
+	while(fgets(buffer, sizeof(buffer), listing))
+	{
+		char *p = buffer;
+		int lineNumber = strtol(p, &p, 10) - 2;   // First line switches to Intel syntax
+
+		if(p == buffer || lineNumber < 0 || lineNumber >= lines)
+		{
+			continue;
+		}
+
+		while(*p == ' ') p++;
+
+		if(*p == '\t' || *p == '\0')   // No code
+		{
+			continue;
+		}
+
+		while(*p && *p != ' ') p++;   // Address
+
+		while(*p && *p != '\t')
+		{
+			if(isxdigit(p[0]) && isxdigit(p[1]) && gasLength[lineNumber] < 16)
+			{
+				char byte[3] = {p[0], p[1], '\0'};
+				gasCode[lineNumber][gasLength[lineNumber]++] = (unsigned char)strtoul(byte, 0, 16);
+				p += 2;
+			}
+			else
+			{
+				p++;
+			}
+		}
+	}
+}
+
+int printBytes(char *buffer, const unsigned char *code, int length)
+{
+	char *start = buffer;
+
+	for(int i = 0; i < length; i++)
+	{
+		buffer += sprintf(buffer, "%.2X ", code[i]);
+	}
+
+	return buffer - start;
+}
+
+// Different encodings of the same instruction, according to GNU objdump
+void disassemble(const char *objdump, const unsigned char (*code)[SLOT], const int *length, int count, char (*text)[128])
+{
+	FILE *binary = fopen("Verify.bin", "wb");
+
+	if(!binary)
+	{
+		return;
+	}
+
+	for(int i = 0; i < count; i++)
+	{
+		unsigned char slot[SLOT];
+		memset(slot, 0x90, SLOT);   // Padded with nop
+		memcpy(slot, code[i], length[i]);
+		fwrite(slot, 1, SLOT, binary);
+	}
+
+	fclose(binary);
+
+	char command[256];
+	sprintf(command, "%s -D -b binary -m i386 -M intel --insn-width=16 Verify.bin > Verify.dis 2> Verify.err", objdump);
+	system(command);
+
+	FILE *listing = fopen("Verify.dis", "r");
+
+	if(!listing)
+	{
+		return;
+	}
+
+	char buffer[1024];
+
+	while(fgets(buffer, sizeof(buffer), listing))
+	{
+		char *p = buffer;
+		const int address = strtol(p, &p, 16);
+
+		if(p == buffer || *p != ':' || address % SLOT != 0 || address / SLOT >= count)
+		{
+			continue;
+		}
+
+		p++;
+		while(*p == ' ' || *p == '\t') p++;
+
+		int bytes = 0;
+
+		while(isxdigit(p[0]) && isxdigit(p[1]) && (p[2] == ' ' || p[2] == '\t'))
+		{
+			bytes++;
+			p += 3;
+		}
+
+		while(*p == ' ' || *p == '\t') p++;
+
+		// Only counts when exactly the given bytes form the instruction
+		if(bytes == length[address / SLOT] && strncmp(p, "(bad)", 5) != 0)
+		{
+			char *out = text[address / SLOT];
+			int n = 0;
+
+			for(bool space = false; *p && *p != '\n' && n < 127; p++)
+			{
+				if(*p == ' ' || *p == '\t')
+				{
+					space = true;
+					continue;
+				}
+
+				if(space && n) out[n++] = ' ';
+				space = false;
+				out[n++] = *p;
+			}
+
+			out[n] = '\0';
+		}
+	}
+
+	fclose(listing);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *assembler = argc > 1 ? argv[1] : "as";
+	const char *objdump = argc > 2 ? argv[2] : "objdump";
+
+	printf("Verifying encodings against '%s'...\n\n", assembler);
+
+	InstructionSet instructionSet;
+	int skipped = 0;
+
+	FILE *source = fopen("Verify.asm", "w");
+	FILE *gas = fopen("Verify.s", "w");
+
+	if(!source || !gas)
+	{
+		if(source) fclose(source);
+		if(gas) fclose(gas);
+
+		printf("Could not create source files\n");
+		return 1;
+	}
+
+	const int lines = generateSource(instructionSet, source, gas, skipped);
+
+	fclose(source);
+	fclose(gas);
+
+	char command[256];
+	sprintf(command, "%s --32 -msyntax=intel -mnaked-reg -al=Verify.lst --listing-lhs-width=4 -o Verify.o Verify.s 2> Verify.err", assembler);
+	system(command);
+
+	FILE *listing = fopen("Verify.lst", "r");
+
+	if(!listing)
+	{
+		printf("GNU assembler did not produce a listing\n");
+		return 1;
+	}
+
+	unsigned char (*gasCode)[16] = new unsigned char[lines][16];
+	int *gasLength = new int[lines];
+	memset(gasLength, 0, lines * sizeof(int));
+
+	readListing(listing, gasCode, gasLength, lines);
+	fclose(listing);
+
+	Scanner scanner;
+	Synthesizer synthesizer;
+	Parser parser(scanner, synthesizer, instructionSet);
+
+	source = fopen("Verify.asm", "r");
+
+	if(!source)
+	{
+		printf("Could not read back Verify.asm\n");
+
+		delete[] gasCode;
+		delete[] gasLength;
+
+		return 1;
+	}
+
+	scanner.scanFile("Verify.asm");
+	scanner.rewind();
+
+	int identical = 0;
+	int equivalents = 0;
+	int mismatches = 0;
+	int rejected = 0;
+
+	// Lines whose bytes differ, checked with objdump afterwards
+	char (*differing)[256] = new char[lines][256];
+	unsigned char (*code)[SLOT] = new unsigned char[lines][SLOT];
+	int *length = new int[lines];
+	char (*error)[128] = new char[lines][128];
+	int *gasLine = new int[lines];
+	int count = 0;
+
+	for(int line = 0; line < lines && !scanner.isEndOfFile(); line++)
+	{
+		char *text = differing[count];
+		text[0] = '\0';
+		fgets(text, 256, source);
+		text[strcspn(text, "\r\n")] = '\0';
+
+		unsigned char buffer[32];
+		length[count] = 0;
+		error[count][0] = '\0';
+
+		try
+		{
+			const Encoding &encoding = parser.parseLine();
+			length[count] = encoding.writeCode(buffer);
+		}
+		catch(const Error &exception)
+		{
+			strncpy(error[count], exception.getString(), 127);
+			error[count][127] = '\0';
+			parser.skipLine();
+		}
+
+		if(scanner.isEndOfLine() && !scanner.isEndOfFile())
+		{
+			scanner.advance();
+		}
+
+		if(gasLength[line] == 0)
+		{
+			rejected++;
+			continue;
+		}
+
+		if(!error[count][0] && length[count] == gasLength[line] && memcmp(buffer, gasCode[line], length[count]) == 0)
+		{
+			identical++;
+			continue;
+		}
+
+		if(length[count] > SLOT)
+		{
+			sprintf(error[count], "%d byte encoding", length[count]);
+		}
+
+		memcpy(code[count], buffer, error[count][0] ? 0 : length[count]);
+		gasLine[count++] = line;
+	}
+
+	fclose(source);
+
+	unsigned char (*gasDiffering)[SLOT] = new unsigned char[count + 1][SLOT];
+	int *gasDifferingLength = new int[count + 1];
+	int *softLength = new int[count + 1];
+	char (*softText)[128] = new char[count + 1][128];
+	char (*gasText)[128] = new char[count + 1][128];
+
+	for(int i = 0; i < count; i++)
+	{
+		memcpy(gasDiffering[i], gasCode[gasLine[i]], gasLength[gasLine[i]]);
+		gasDifferingLength[i] = gasLength[gasLine[i]];
+		softLength[i] = error[i][0] ? 0 : length[i];
+		softText[i][0] = '\0';
+		gasText[i][0] = '\0';
+	}
+
+	disassemble(objdump, code, softLength, count, softText);
+	disassemble(objdump, gasDiffering, gasDifferingLength, count, gasText);
+
+	for(int i = 0; i < count; i++)
+	{
+		if(!error[i][0] && softText[i][0] && strcmp(softText[i], gasText[i]) == 0)
+		{
+			equivalents++;
+			continue;
+		}
+
+		char bytes[128];
+		mismatches++;
+
+		printf("%s\n", differing[i]);
+
+		if(error[i][0])
+		{
+			printf("\tSoftWire: %s\n", error[i]);
+		}
+		else
+		{
+			printBytes(bytes, code[i], length[i]);
+			printf("\tSoftWire: %s\n", bytes);
+		}
+
+		printBytes(bytes, gasDiffering[i], gasDifferingLength[i]);
+		printf("\tGNU as:   %s\n", bytes);
+	}
+
+	delete[] differing;
+	delete[] code;
+	delete[] length;
+	delete[] error;
+	delete[] gasLine;
+	delete[] gasDiffering;
+	delete[] gasDifferingLength;
+	delete[] softLength;
+	delete[] softText;
+	delete[] gasText;
+	delete[] gasCode;
+	delete[] gasLength;
+
+	printf("\n%d lines: %d identical, %d equivalent, %d mismatched, %d not accepted by GNU as (%d entries skipped)\n", lines, identical, equivalents, mismatches, rejected, skipped);
+
+	return mismatches ? 1 : 0;
+}